@@ -0,0 +1,215 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include <time.h>
+#include <atomic>
+#include <thread>
+#include "sim_hal.h"
+#include "../src/core/events.h"
+#include "../src/core/event_payload.h"
+
+// ============================================================================
+// ionOS v1.0 - EVENT QUEUE STRESS BENCHMARK (native host build)
+// Hammers the lock-free EventQueue from host threads while this thread
+// consumes, the same check as the `test-events` console command but with
+// real parallel producers. Every run must deliver each posted event exactly
+// once, in order per producer and priority level. Also checks that a full
+// level drops and counts the overflow, and that coalesced posts fold into
+// one queued event. Exits non-zero on any failure.
+// Run: .pio/build/native-events/program
+// ============================================================================
+
+static const uint8_t MAX_PRODUCERS = 8;
+static const uint32_t EVENTS_PER_PRODUCER = 50000;
+static const uint16_t LEVEL_CAPACITY = 64;
+
+static int failures = 0;
+
+struct Producer {
+    uint8_t id;
+    uint32_t posted;
+    uint32_t retries;           // Posts refused by a full level
+    std::atomic<bool> done;
+};
+
+static Producer producers[MAX_PRODUCERS];
+
+static uint64_t hostMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static void check(bool ok, const char *what) {
+    if (!ok) {
+        Serial.printf("[BENCH] FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+static Event customEvent(uint8_t producer, uint32_t seq) {
+    Event event = {
+        .type = EVENT_CUSTOM,
+        .priority = (EventPriority)(seq & 3),
+        .timestamp = 0,
+        .data1 = producer,
+        .data2 = 0,
+        .data3 = (void*)(uintptr_t)seq
+    };
+    return event;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Many producers, one consumer
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static void produce(Producer *producer) {
+    for (uint32_t seq = 0; seq < EVENTS_PER_PRODUCER; seq++) {
+        // Retry on a full level (postEventFromISR never logs)
+        while (!EventQueue::postEventFromISR(customEvent(producer->id, seq))) {
+            producer->retries++;
+            std::this_thread::yield();
+        }
+        producer->posted++;
+    }
+    producer->done.store(true, std::memory_order_release);
+}
+
+static void benchStress(uint8_t count) {
+    EventQueue::init(LEVEL_CAPACITY);
+
+    int64_t last_seq[MAX_PRODUCERS][4];
+    for (int i = 0; i < MAX_PRODUCERS; i++) {
+        for (int p = 0; p < 4; p++) last_seq[i][p] = -1;
+    }
+    uint32_t received = 0;
+    uint32_t order_errors = 0;
+    uint32_t foreign = 0;
+
+    uint64_t start = hostMicros();
+    std::thread threads[MAX_PRODUCERS];
+    for (uint8_t i = 0; i < count; i++) {
+        producers[i].id = i;
+        producers[i].posted = 0;
+        producers[i].retries = 0;
+        producers[i].done.store(false);
+        threads[i] = std::thread(produce, &producers[i]);
+    }
+
+    bool producing = true;
+    while (producing || !EventQueue::isEmpty()) {
+        producing = false;
+        for (uint8_t i = 0; i < count; i++) {
+            if (!producers[i].done.load(std::memory_order_acquire)) producing = true;
+        }
+
+        Event event;
+        while (EventQueue::getEvent(event)) {
+            if (event.type != EVENT_CUSTOM || event.data1 >= count) {
+                foreign++;
+                continue;
+            }
+            int64_t seq = (int64_t)(uintptr_t)event.data3;
+            if (seq <= last_seq[event.data1][event.priority]) {
+                order_errors++;
+            }
+            last_seq[event.data1][event.priority] = seq;
+            received++;
+        }
+        std::this_thread::yield();
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        threads[i].join();
+    }
+    uint64_t elapsed = hostMicros() - start;
+
+    uint32_t posted = 0;
+    uint32_t retries = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        posted += producers[i].posted;
+        retries += producers[i].retries;
+    }
+
+    Serial.printf("%d producers: %8lu events %8lu retries %7.1f ns/event %s\n",
+        count, (unsigned long)received, (unsigned long)retries,
+        posted ? elapsed * 1000.0 / posted : 0.0,
+        (posted == received && order_errors == 0 && foreign == 0) ? "ok" : "FAILED");
+    check(posted == received, "every posted event is delivered once");
+    check(order_errors == 0, "events keep their order per producer and level");
+    check(foreign == 0, "no unexpected events");
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// A full level drops and counts the overflow; the rest stays FIFO
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static void benchOverflow() {
+    EventQueue::init(LEVEL_CAPACITY);
+
+    uint32_t accepted = 0;
+    for (uint32_t seq = 0; seq < LEVEL_CAPACITY + 10; seq++) {
+        Event event = customEvent(0, seq);
+        event.priority = PRIORITY_NORMAL;
+        if (EventQueue::postEventFromISR(event)) accepted++;
+    }
+
+    uint32_t in_order = 0;
+    Event event;
+    while (EventQueue::getEvent(event)) {
+        if ((uintptr_t)event.data3 == in_order) in_order++;
+    }
+
+    Serial.printf("full level: %lu accepted, %lu dropped, %lu in order\n",
+        (unsigned long)accepted, (unsigned long)EventQueue::getDroppedCount(PRIORITY_NORMAL),
+        (unsigned long)in_order);
+    check(accepted == LEVEL_CAPACITY, "a level holds exactly its capacity");
+    check(EventQueue::getDroppedCount(PRIORITY_NORMAL) == 10, "overflow is counted");
+    check(in_order == LEVEL_CAPACITY, "accepted events come out in order");
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Parallel posts of a coalesced type fold into one queued event
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static void benchCoalesce() {
+    EventQueue::init(LEVEL_CAPACITY);
+    EventQueue::setCoalescePolicy(EVENT_DISPLAY_UPDATE, COALESCE_BITS);
+
+    std::thread threads[MAX_PRODUCERS];
+    for (uint8_t i = 0; i < MAX_PRODUCERS; i++) {
+        threads[i] = std::thread([i]() {
+            for (int n = 0; n < 10000; n++) {
+                Event event = { EVENT_DISPLAY_UPDATE, PRIORITY_NORMAL, 0, (uint8_t)(1 << i), 0, nullptr };
+                EventQueue::postEventFromISR(event);
+            }
+        });
+    }
+    for (uint8_t i = 0; i < MAX_PRODUCERS; i++) {
+        threads[i].join();
+    }
+
+    uint32_t queued = EventQueue::getEventCount();
+    Event event = {};
+    EventQueue::getEvent(event);
+    Serial.printf("coalesce: %lu queued, merged bits 0x%02x, %lu posts folded\n",
+        (unsigned long)queued, event.data1, (unsigned long)EventQueue::getCoalescedCount());
+    check(queued == 1, "coalesced posts keep one event queued");
+    check(event.data1 == 0xFF, "every producer's bit is merged");
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Sketch entry points
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void setup() {
+    Serial.printf("\n[BENCH] EventQueue stress (%d events per producer, %d per level)\n",
+        (int)EVENTS_PER_PRODUCER, LEVEL_CAPACITY);
+    for (uint8_t count = 1; count <= MAX_PRODUCERS; count *= 2) {
+        benchStress(count);
+    }
+    benchOverflow();
+    benchCoalesce();
+    EventQueue::printDebugInfo();
+
+    Serial.println(failures ? "[BENCH] Event queue stress FAILED" : "[BENCH] Event queue stress PASSED");
+    SimHAL::requestExit(failures ? 1 : 0);
+}
+
+void loop() {
+}
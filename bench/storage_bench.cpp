@@ -0,0 +1,252 @@
+#include <Arduino.h>
+#include <SD.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "sim_hal.h"
+#include "../src/services/storage_service.h"
+
+// ============================================================================
+// ionOS v1.0 - STORAGE THROUGHPUT BENCHMARK (native host build)
+// Runs the StorageService read paths against the simulated SD card (a host
+// directory, see SimHAL::setSDRoot) and compares them with the old
+// byte-at-a-time File::read() loop. Card time comes from the sim's SPI
+// model (per-call driver overhead + sectors clocked at the SD clock); the
+// last rows repeat the small reads on the LittleFS flash partition.
+// Run: .pio/build/native-bench/program
+// ============================================================================
+
+static const char *CONFIG_PATH = "/sd/bench/config.txt";  // ~4 KB of key=value lines
+static const char *LOG_PATH = "/sd/bench/log.txt";        // ~64 KB of log lines
+static const char *MEDIA_PATH = "/sd/bench/media.bin";    // 256 KB blob
+static const char *FLASH_CONFIG_PATH = "/flash/bench/config.txt";
+static const char *FLASH_MEDIA_PATH = "/flash/bench/media.bin";
+
+static const uint32_t MEDIA_SIZE = 256 * 1024;
+static const uint8_t CONFIG_LOADS = 20;
+
+static uint8_t expected[MEDIA_SIZE];
+static uint8_t buffer[MEDIA_SIZE];
+static int failures = 0;
+
+struct BenchSample {
+    SimStorageStats card;
+    uint64_t host_us;
+};
+
+static bool on_flash = false;      // Rows measure the flash partition
+
+static uint64_t hostMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static const SimStorageStats& deviceStats() {
+    return on_flash ? SimHAL::getFlashStats() : SimHAL::getStorageStats();
+}
+
+static BenchSample begin() {
+    SimHAL::resetStorageStats();
+    SimHAL::resetFlashStats();
+    return { deviceStats(), hostMicros() };
+}
+
+static void report(const char *name, const BenchSample &start, uint32_t bytes) {
+    const SimStorageStats &card = deviceStats();
+    uint64_t card_us = card.bus_time_us - start.card.bus_time_us;
+    uint64_t host_us = hostMicros() - start.host_us;
+    uint32_t kbps = card_us ? (uint32_t)((uint64_t)bytes * 1000000ULL / 1024 / card_us) : 0;
+    Serial.printf("%-28s %8lu B %7lu calls %6lu sectors %9.2f ms card %6lu KB/s %8lu us host\n",
+        name, (unsigned long)bytes, (unsigned long)(card.calls - start.card.calls),
+        (unsigned long)(card.sectors - start.card.sectors), card_us / 1000.0,
+        (unsigned long)kbps, (unsigned long)host_us);
+}
+
+static void check(bool ok, const char *what) {
+    if (!ok) {
+        Serial.printf("[BENCH] FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Test files
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static uint32_t writeTextFile(const char *path, uint32_t target, const char *format) {
+    char line[80];
+    uint32_t length = 0;
+    for (uint32_t i = 0; length < target; i++) {
+        int n = snprintf(line, sizeof(line), format, (unsigned long)i, (unsigned long)(i * 2654435761UL));
+        memcpy(expected + length, line, n);
+        length += n;
+    }
+    StorageService::writeFile(path, expected, length);
+    return length;
+}
+
+static void createFiles() {
+    StorageService::createDir("/sd/bench");
+    StorageService::createDir("/flash/bench");
+    for (uint32_t i = 0; i < MEDIA_SIZE; i++) {
+        expected[i] = (uint8_t)(i * 131 + (i >> 9));
+    }
+    StorageService::writeFile(MEDIA_PATH, expected, MEDIA_SIZE);
+    StorageService::writeFile(FLASH_MEDIA_PATH, expected, MEDIA_SIZE);
+    writeTextFile(LOG_PATH, 64 * 1024, "[%08lu] INFO  kernel: tick ok, seq=%lu\n");
+    writeTextFile(CONFIG_PATH, 4 * 1024, "setting_%03lu=%lu\n");
+    writeTextFile(FLASH_CONFIG_PATH, 4 * 1024, "setting_%03lu=%lu\n");
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Old path: one File::read() per byte
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Straight to the card: paths without the mount point
+static File openOnCard(const char *path) {
+    return SD.open(path + strlen(SD_MOUNT_POINT), FILE_READ);
+}
+
+static uint32_t byteLoopRead(const char *path, uint8_t *out, uint32_t max_len) {
+    File file = openOnCard(path);
+    if (!file) return 0;
+
+    uint32_t bytes_read = 0;
+    while (file.available() && bytes_read < max_len) {
+        out[bytes_read++] = file.read();
+    }
+    file.close();
+    return bytes_read;
+}
+
+static uint32_t byteLoopLines(const char *path, uint32_t &checksum) {
+    File file = openOnCard(path);
+    if (!file) return 0;
+
+    uint32_t lines = 0;
+    while (file.available()) {
+        int c = file.read();
+        checksum = checksum * 31 + (uint8_t)c;
+        if (c == '\n') lines++;
+    }
+    file.close();
+    return lines;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Benchmarks
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static void configLoads(const char *name, const char *path, uint32_t expected_size) {
+    uint32_t size = 0;
+    StorageService::closeAll();
+    memset(buffer, 0, expected_size);
+    BenchSample start = begin();
+    for (uint8_t i = 0; i < CONFIG_LOADS; i++) {
+        size = StorageService::getFileSize(path);
+        StorageService::readFile(path, buffer, size);
+    }
+    report(name, start, size * CONFIG_LOADS);
+    check(size == expected_size && memcmp(buffer, expected, size) == 0, "config contents");
+}
+
+static void benchConfigLoads() {
+    uint32_t size = 0;
+    BenchSample start = begin();
+    for (uint8_t i = 0; i < CONFIG_LOADS; i++) {
+        size = byteLoopRead(CONFIG_PATH, buffer, sizeof(buffer));
+    }
+    report("config x20, byte loop", start, size * CONFIG_LOADS);
+    memcpy(expected, buffer, size);
+
+    configLoads("config x20, size + readFile", CONFIG_PATH, size);
+}
+
+static void benchLogReplay() {
+    uint32_t checksum_old = 0;
+    BenchSample start = begin();
+    uint32_t lines_old = byteLoopLines(LOG_PATH, checksum_old);
+    uint32_t size = StorageService::getFileSize(LOG_PATH);
+    report("log replay, byte loop", start, size);
+
+    StorageService::closeAll();
+    char line[96];
+    uint32_t lines = 0;
+    uint32_t checksum = 0;
+    start = begin();
+    StorageHandle log = StorageService::openStream(LOG_PATH, STORAGE_MODE_READ);
+    while (StorageService::readLine(log, line, sizeof(line))) {
+        for (const char *c = line; *c; c++) checksum = checksum * 31 + (uint8_t)*c;
+        checksum = checksum * 31 + '\n';
+        lines++;
+    }
+    StorageService::closeStream(log);
+    report("log replay, readLine", start, size);
+    check(lines == lines_old && checksum == checksum_old, "log lines");
+}
+
+static void benchMedia() {
+    BenchSample start = begin();
+    uint32_t size = byteLoopRead(MEDIA_PATH, buffer, sizeof(buffer));
+    report("media 256K, byte loop", start, size);
+
+    StorageService::closeAll();
+    memset(buffer, 0, sizeof(buffer));
+    start = begin();
+    StorageService::readFile(MEDIA_PATH, buffer, MEDIA_SIZE);
+    report("media 256K, readFile", start, MEDIA_SIZE);
+
+    for (uint32_t i = 0; i < MEDIA_SIZE; i++) {
+        if (buffer[i] != (uint8_t)(i * 131 + (i >> 9))) {
+            check(false, "media contents");
+            break;
+        }
+    }
+}
+
+static void benchRecords(const char *name, const char *path) {
+    // 32-byte records at scattered offsets (table lookups, save slots)
+    uint8_t record[32];
+    uint32_t bytes = 0;
+    StorageService::closeAll();
+    BenchSample start = begin();
+    for (uint32_t i = 0; i < 512; i++) {
+        uint32_t offset = (i * 7919 % 64) * 32 + (i / 64) * 2048;
+        int32_t got = StorageService::readAt(path, offset, record, sizeof(record));
+        bytes += got > 0 ? got : 0;
+        check(got == (int32_t)sizeof(record) && record[0] == (uint8_t)(offset * 131 + (offset >> 9)), "record contents");
+    }
+    report(name, start, bytes);
+}
+
+static void benchFlash() {
+    // Same small reads on the internal flash partition (40 MHz DIO)
+    uint32_t size = StorageService::getFileSize(FLASH_CONFIG_PATH);
+    on_flash = true;
+    configLoads("flash: config x20, readFile", FLASH_CONFIG_PATH, size);
+    benchRecords("flash: records 512 x 32B", FLASH_MEDIA_PATH);
+    on_flash = false;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Sketch entry points
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void setup() {
+    if (!StorageService::init()) {
+        Serial.println("[BENCH] No storage");
+        SimHAL::requestExit(1);
+        return;
+    }
+    createFiles();
+
+    Serial.println("\n[BENCH] StorageService read throughput (simulated SD, 4 MHz SPI)");
+    benchConfigLoads();
+    benchLogReplay();
+    benchMedia();
+    benchRecords("records 512 x 32B, readAt", MEDIA_PATH);
+    benchFlash();
+    StorageService::printDebugInfo();
+
+    SimHAL::requestExit(failures ? 1 : 0);
+}
+
+void loop() {
+}
@@ -36,13 +36,7 @@
 #define BTN_DEBOUNCE_MS 20
 #define BTN_LONG_PRESS_MS 800
 
-// Button event IDs
-#define BTN_ID_UP 0
-#define BTN_ID_DOWN 1
-#define BTN_ID_LEFT 2
-#define BTN_ID_RIGHT 3
-#define BTN_ID_SELECT 4
-#define BTN_ID_BACK 5
+// Button event IDs: see enum ButtonID in src/core/events.h
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // BATTERY (ADC reading)
@@ -12,7 +12,17 @@
 // DEBUG & LOGGING
 // ---------------------------------------------------------------------------
 #define IONOS_DEBUG 1           // Enable serial debug output
-#define LOG_LEVEL 3             // 0=ERROR, 1=WARN, 2=INFO, 3=DEBUG
+#define LOG_LEVEL 0             // 0=DEBUG, 1=INFO, 2=WARN, 3=ERROR, 4=CRITICAL (LogService default)
+
+// LogService: callers queue binary records, a service task formats them
+#define LOG_RING_SIZE 64              // Queued records (power of two; 12 + LOG_ARG_BYTES + 4 bytes each on the ESP32)
+#define LOG_ARG_BYTES 52              // Captured arguments per record (%s text is copied in)
+#define LOG_MAX_TAGS 16               // Registered tags (0 = "SYS")
+#define LOG_FLUSH_INTERVAL_MS 100     // How often queued records are written out
+#define LOG_LINE_MAX 160              // Longest formatted line
+#define LOG_BATCH_BYTES 512           // Lines gathered per serial/file write
+#define LOG_FILE_PATH "/flash/logs/system.log"
+#define LOG_FILE_MAX_BYTES 65536      // Rotated to LOG_FILE_PATH ".1" beyond this
 
 // ---------------------------------------------------------------------------
 // DISPLAY CONFIGURATION
@@ -21,6 +31,13 @@
 #define DISPLAY_HEIGHT 64
 #define DISPLAY_FPS 60          // Target refresh rate
 #define DISPLAY_I2C_FREQ 400000 // I2C frequency (400kHz)
+#define DISPLAY_PARTIAL_UPDATE 1 // Flush only dirty 8x8 tiles (0 = full sendBuffer)
+#define SPRITE_BATCH_SIZE 72    // Sprites SpriteBatch can queue per frame
+#define GLYPH_CACHE_SLOTS 128   // Rasterized glyphs kept by GlyphCache
+#define GLYPH_MAX_WIDTH 10      // Glyph size limit; larger fonts bypass the cache
+#define GLYPH_MAX_HEIGHT 16     // (rows, ascent + descent)
+#define TEXT_LAYOUT_SLOTS 8     // Rendered strings drawString() keeps for redraws
+#define TEXT_LAYOUT_MAX_CHARS 24
 
 // ---------------------------------------------------------------------------
 // BUTTON CONFIGURATION
@@ -29,6 +46,9 @@
 #define BTN_LONG_PRESS_MS 800   // Long press threshold
 #define BTN_REPEAT_DELAY_MS 500 // Key repeat delay
 #define BTN_REPEAT_RATE_MS 100  // Key repeat rate
+#define BTN_USE_INTERRUPTS 1    // Capture edges in GPIO ISRs (0 = poll pins)
+#define BTN_EDGE_QUEUE_SIZE 64  // ISR edge ring slots (power of two)
+#define BTN_EVENT_QUEUE_SIZE 16 // Debounced event ring slots (power of two)
 
 // ---------------------------------------------------------------------------
 // BATTERY & POWER
@@ -36,6 +56,7 @@
 #define BAT_MIN_MV 3000             // Minimum battery voltage (mV)
 #define BAT_MAX_MV 4200             // Maximum battery voltage (mV)
 #define BAT_SAMPLE_INTERVAL_MS 5000 // Battery check interval
+#define BAT_ADC_SETTLE_US 2000      // ADC input settle before the first reading
 
 // ---------------------------------------------------------------------------
 // POWER MANAGEMENT
@@ -53,12 +74,27 @@
 #define AUDIO_CHANNELS 2          // Stereo
 #define AUDIO_BUFFER_SIZE 512     // DMA buffer size
 #define AUDIO_MAX_VOLUME 100      // Max volume percentage
+#define AUDIO_STREAM_BUFFER 8192  // File-to-I2S ring (power of two, ~46 ms at 44.1 kHz stereo)
 
 // ---------------------------------------------------------------------------
 // STORAGE & SD CARD
 // ---------------------------------------------------------------------------
 #define SD_MAX_FILES 256          // Max files to list
-#define SD_MOUNT_POINT "/sdcard"
+#define SD_MOUNT_POINT "/sd"          // Media, music (MicroSD card)
+#define FLASH_MOUNT_POINT "/flash"    // Settings, logs, snapshots (LittleFS on internal flash)
+#define STORAGE_MAX_MOUNTS 4      // Mount table slots
+#define STORAGE_OPEN_FILES 4      // Read handles kept open between calls (SD allows 5 open files)
+#define STORAGE_READ_AHEAD 512    // Read-ahead block per handle (one SD sector)
+#define STORAGE_PATH_MAX 64       // Longest path the handle table keeps
+#define OTA_FLASH_CHUNK 1024      // Firmware image bytes per flash write
+#define SETTINGS_LOG_PATH "/flash/settings.kv"  // Settings store record log
+#define SETTINGS_MAX_KEYS 32      // Distinct settings kept in RAM
+#define SETTINGS_KEY_MAX 16       // Key buffer (15 chars + terminator)
+#define SETTINGS_VALUE_MAX 32     // Largest value in bytes
+#define SETTINGS_INDEX_SLOTS 64   // Hash index slots (power of two, > SETTINGS_MAX_KEYS)
+#define SETTINGS_COMMIT_DELAY_MS 2000   // Quiet time before changes are written
+#define SETTINGS_COMMIT_MAX_MS 10000    // Longest a change waits while more keep coming
+#define SETTINGS_COMPACT_BYTES 4096     // Log size from which stale records are compacted away
 #define ENABLE_OTA_UPDATES 1      // Enable OTA firmware updates
 
 // ---------------------------------------------------------------------------
@@ -79,16 +115,61 @@
 // APP & KERNEL CONFIGURATION
 // ---------------------------------------------------------------------------
 #define MAX_APPS 10             // Maximum number of apps
-#define MAX_EVENTS 32           // Max events in queue
+#define HOME_APP_ID 0           // Launcher slot; BACK returns here
+#define APP_SNAPSHOT_MAX 512    // Largest app state snapshot (one pool block)
+#define APP_SNAPSHOT_DIR "/flash/.snapshots"  // Where StorageService keeps them
+#define MAX_EVENTS 256          // Event queue slots over all priority levels
+#define EVENT_LOW_MAX_WAIT 8    // Dequeues a waiting LOW event can be passed over
+#define MAX_COALESCED_TYPES 8   // Event types with a coalescing policy
 #define KERNEL_TICK_MS 10       // Kernel tick interval (10ms)
+#define MAX_KERNEL_TASKS 16     // Scheduler slots (8 built-in phases + device retry + services)
+#define MAX_EVENT_SUBSCRIBERS 32        // Kernel event subscriptions (all types)
+#define EVENT_DISPATCH_BUDGET_US 2000   // Per-tick dispatch time (critical events exempt)
+#define EVENT_PAYLOAD_BLOCKS 16         // Ref-counted event payload blocks
+#define EVENT_PAYLOAD_SIZE 256          // Bytes per payload block
+#define BTN_POLL_INTERVAL_US 1000       // Button scan period when polling (1 kHz)
+#define BTN_SERVICE_INTERVAL_US 10000   // Debounce/long-press pass with edge IRQs
+#define POWER_CHECK_INTERVAL_MS 1000    // Low battery / charger check
+#define MEMORY_CHECK_INTERVAL_MS 10000  // Heap watermark check
+#define TIME_CHECK_INTERVAL_MS 1000     // Alarm check (service runner)
+#define AUDIO_UPDATE_INTERVAL_MS 10     // Playback refill (stream runner)
+#define NETWORK_UPDATE_INTERVAL_MS 500  // WiFi status poll (stream runner)
 #define STACK_SIZE_LARGE 8192   // Large task stack (bytes)
 #define STACK_SIZE_SMALL 2048   // Small task stack (bytes)
 
+// Kernel runners: loop() (core 1) keeps input/events/apps/render; services
+// and streaming get their own pinned tasks on core 0
+#define KERNEL_MULTICORE 1              // 0 = run every task from loop()
+#define SERVICE_TASK_CORE 0
+#define SERVICE_TASK_STACK STACK_SIZE_LARGE   // SD/FAT and log formatting
+#define SERVICE_TASK_PRIORITY 2
+#define STREAM_TASK_CORE 0
+#define STREAM_TASK_STACK STACK_SIZE_LARGE    // HTTP and audio decode
+#define STREAM_TASK_PRIORITY 3          // Above services: audio underruns are audible
+#define RUNNER_NATIVE_MAX_WAIT_US 2000  // Native runner wait cap (sim time can jump)
+
+// Boot: stage timeline, splash as the first frame, TTFF/TTI metrics
+#define BOOT_SPLASH 1                   // Draw a splash right after display init
+#define BOOT_TIMELINE_STAGES 16         // Timeline slots (extra stages are not recorded)
+#define BOOT_TIMELINE_REPORT 1          // Print TTFF/TTI once the device is interactive
+
+// Drivers that fail init are retried in the background instead of halting
+#define DEVICE_RETRY_MIN_MS 1000        // First retry; doubles after each failure
+#define DEVICE_RETRY_MAX_MS 60000       // Backoff cap
+
 // ---------------------------------------------------------------------------
 // MEMORY & OPTIMIZATION
 // ---------------------------------------------------------------------------
 #define ENABLE_PSRAM 0             // Use PSRAM if available
 #define FREE_HEAP_THRESHOLD 10000  // Warning threshold (bytes)
+#define HEAP_FRAG_WARN_PERCENT 60  // Warn when fragmentation exceeds this
+#define MEM_ARENA_SIZE 16384       // Static boot arena (pools + boot-lifetime objects)
+#define MEM_POOL_32_BLOCKS 32      // Block pools carved from the arena
+#define MEM_POOL_64_BLOCKS 16
+#define MEM_POOL_128_BLOCKS 16
+#define MEM_POOL_256_BLOCKS 8
+#define MEM_POOL_512_BLOCKS 4
+#define MEM_HISTORY_SAMPLES 12     // Heap samples kept (one per memory check)
 
 // ---------------------------------------------------------------------------
 // FEATURE FLAGS
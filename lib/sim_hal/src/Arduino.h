@@ -0,0 +1,139 @@
+#ifndef IONOS_SIM_ARDUINO_H
+#define IONOS_SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+#include "esp_sleep.h"
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED ARDUINO CORE (native host build)
+// Subset of the Arduino-ESP32 API used by ionOS, backed by the host
+// ============================================================================
+
+// Digital I/O
+#define LOW 0x0
+#define HIGH 0x1
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+
+// Interrupts (fired by SimHAL::setPin on a level change)
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define IRAM_ATTR
+#define digitalPinToInterrupt(p) (p)
+
+// ADC
+typedef enum {
+    ADC_0db = 0,
+    ADC_2_5db = 1,
+    ADC_6db = 2,
+    ADC_11db = 3
+} adc_attenuation_t;
+
+// Math helpers (arduino-esp32 pulls these in from <algorithm>)
+using std::min;
+using std::max;
+
+// Timing
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// GPIO
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+// GPIO interrupts
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void attachInterruptArg(uint8_t pin, void (*isr)(void*), void *arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+// ADC
+uint16_t analogRead(uint8_t pin);
+void analogSetPinAttenuation(uint8_t pin, adc_attenuation_t attenuation);
+void analogSetClockDiv(uint8_t clock_div);
+
+// Minimal Arduino String
+class String {
+public:
+    String() {}
+    String(const char *str) : value(str ? str : "") {}
+    String(const std::string &str) : value(str) {}
+
+    unsigned int length() const { return value.length(); }
+    const char* c_str() const { return value.c_str(); }
+    void trim();
+    bool startsWith(const char *prefix) const { return value.compare(0, strlen(prefix), prefix) == 0; }
+    String substring(unsigned int from) const { return from < value.length() ? String(value.substr(from)) : String(); }
+    int toInt() const { return atoi(value.c_str()); }
+
+    bool operator==(const char *other) const { return value == other; }
+    bool operator!=(const char *other) const { return value != other; }
+    String& operator+=(char c) { value += c; return *this; }
+
+private:
+    std::string value;
+};
+
+// Serial port (stdout / non-blocking stdin)
+class HardwareSerial {
+public:
+    void begin(unsigned long baud);
+    void end() {}
+    void flush();
+
+    int available();
+    int read();
+    String readStringUntil(char terminator);
+
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *buffer, size_t size);
+
+    size_t print(const char *str);
+    size_t print(const String &str) { return print(str.c_str()); }
+    size_t print(char c);
+    size_t print(int value);
+    size_t print(unsigned int value);
+    size_t print(long value);
+    size_t print(unsigned long value);
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    template <typename T>
+    size_t println(const T &value) { size_t n = print(value); return n + println(); }
+
+    size_t printf(const char *format, ...);
+
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// Chip info / heap statistics
+class EspClass {
+public:
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getHeapSize();
+    uint32_t getMaxAllocHeap();
+    uint32_t getFreePsram();
+    uint32_t getCpuFreqMHz() { return 240; }
+    void restart();
+};
+
+extern EspClass ESP;
+
+#endif // IONOS_SIM_ARDUINO_H
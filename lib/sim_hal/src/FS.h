@@ -0,0 +1,104 @@
+#ifndef IONOS_SIM_FS_H
+#define IONOS_SIM_FS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include "sim_hal.h"
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED FILESYSTEM API (native host build)
+// Arduino-ESP32 fs::FS / fs::File front-end. Each volume (SD card, flash
+// partition, plain host directory) is a directory on the host filesystem
+// with its own cost model: every call is charged to the virtual clock as
+// the real device would take, a fixed driver overhead per call plus the
+// blocks moved over the bus whenever a call leaves the block the file last
+// touched.
+// ============================================================================
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+struct SimVolume;
+struct SimFileImpl;
+
+namespace fs {
+
+enum SeekMode {
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+class File {
+public:
+    File() {}
+    explicit File(std::shared_ptr<SimFileImpl> impl) : impl(impl) {}
+
+    size_t read(uint8_t *buf, size_t size);
+    int read();
+    int peek();
+    int available();
+    size_t write(const uint8_t *buf, size_t size);
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t print(const char *str);
+    void flush() {}
+
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void close();
+
+    const char* name() const;
+    const char* path() const;
+    bool isDirectory() const;
+    File openNextFile(const char *mode = FILE_READ);
+
+    operator bool() const;
+
+private:
+    std::shared_ptr<SimFileImpl> impl;
+};
+
+class FS {
+public:
+    explicit FS(SimVolume *volume) : volume(volume) {}
+
+    File open(const char *path, const char *mode = FILE_READ, const bool create = false);
+    bool exists(const char *path);
+    bool remove(const char *path);
+    bool rename(const char *path_from, const char *path_to);
+    bool mkdir(const char *path);
+    bool rmdir(const char *path);
+
+protected:
+    SimVolume *volume;
+};
+
+// Native only: a host directory as a volume, with no device cost
+class HostFS : public FS {
+public:
+    explicit HostFS(const char *root);
+    ~HostFS();
+
+    bool begin();               // Creates the directory if needed
+    void end();
+    uint64_t totalBytes();      // Of the host filesystem holding it
+    uint64_t usedBytes();       // Of the files under it
+
+private:
+    HostFS(const HostFS&) = delete;
+    HostFS& operator=(const HostFS&) = delete;
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif // IONOS_SIM_FS_H
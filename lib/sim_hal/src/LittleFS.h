@@ -0,0 +1,32 @@
+#ifndef IONOS_SIM_LITTLEFS_H
+#define IONOS_SIM_LITTLEFS_H
+
+#include <stdint.h>
+#include "FS.h"
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED LITTLEFS FLASH PARTITION (native host build)
+// Arduino-ESP32 LittleFS front-end over a host directory
+// (SimHAL::setFlashRoot). Cost model: LittleFS overhead per call, reads
+// clocked over the DIO flash bus at 40 MHz, and page programs on writes.
+// ============================================================================
+
+namespace fs {
+
+class LittleFSFS : public FS {
+public:
+    LittleFSFS();
+
+    bool begin(bool format_on_fail = false, const char *base_path = "/littlefs",
+               uint8_t max_open_files = 10, const char *partition_label = "spiffs");
+    void end();
+
+    uint64_t totalBytes();
+    uint64_t usedBytes();
+};
+
+} // namespace fs
+
+extern fs::LittleFSFS LittleFS;
+
+#endif // IONOS_SIM_LITTLEFS_H
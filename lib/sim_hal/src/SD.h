@@ -0,0 +1,41 @@
+#ifndef IONOS_SIM_SD_H
+#define IONOS_SIM_SD_H
+
+#include <stdint.h>
+#include "FS.h"
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED SD CARD (native host build)
+// Arduino-ESP32 SD front-end over a host directory (SimHAL::setSDRoot).
+// Cost model: VFS + FatFS overhead per call, then a command and the
+// 512-byte sectors clocked over SPI at the SD clock.
+// ============================================================================
+
+typedef enum {
+    CARD_NONE,
+    CARD_MMC,
+    CARD_SD,
+    CARD_SDHC,
+    CARD_UNKNOWN
+} sdcard_type_t;
+
+namespace fs {
+
+class SDFS : public FS {
+public:
+    SDFS();
+
+    bool begin(uint8_t ss_pin = 5);
+    void end();
+
+    sdcard_type_t cardType();
+    uint64_t cardSize();
+    uint64_t totalBytes();
+    uint64_t usedBytes();
+};
+
+} // namespace fs
+
+extern fs::SDFS SD;
+
+#endif // IONOS_SIM_SD_H
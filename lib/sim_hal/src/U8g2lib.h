@@ -0,0 +1,118 @@
+#ifndef IONOS_SIM_U8G2LIB_H
+#define IONOS_SIM_U8G2LIB_H
+
+#include <stdint.h>
+#include "sim_hal.h"
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED U8G2 (native host build)
+// Full-buffer SSD1306 128x64 with the U8g2 page-major buffer layout.
+// Fonts are rendered from a built-in 5x7 glyph set; each font array
+// only carries its cell size ({width, height, ascent}).
+// ============================================================================
+
+typedef uint16_t u8g2_uint_t;
+typedef int16_t u8g2_int_t;
+
+struct u8g2_cb_struct {
+    uint8_t rotation;
+};
+typedef struct u8g2_cb_struct u8g2_cb_t;
+
+extern const u8g2_cb_t u8g2_cb_r0;
+#define U8G2_R0 (&u8g2_cb_r0)
+
+#define U8X8_PIN_NONE 255
+
+#define U8G2_DRAW_UPPER_RIGHT 0x01
+#define U8G2_DRAW_UPPER_LEFT 0x02
+#define U8G2_DRAW_LOWER_LEFT 0x04
+#define U8G2_DRAW_LOWER_RIGHT 0x08
+#define U8G2_DRAW_ALL (U8G2_DRAW_UPPER_RIGHT | U8G2_DRAW_UPPER_LEFT | U8G2_DRAW_LOWER_RIGHT | U8G2_DRAW_LOWER_LEFT)
+
+// Fonts ({cell width, cell height, ascent})
+extern const uint8_t u8g2_font_5x8_tf[];
+extern const uint8_t u8g2_font_6x10_tf[];
+extern const uint8_t u8g2_font_6x10_mf[];
+extern const uint8_t u8g2_font_7x14_mf[];
+extern const uint8_t u8g2_font_9x18_mf[];
+extern const uint8_t u8g2_font_10x20_mf[];
+extern const uint8_t u8g2_font_5x8_mn[];
+extern const uint8_t u8g2_font_6x12_mn[];
+extern const uint8_t u8g2_font_7x14_mn[];
+extern const uint8_t u8g2_font_siji_t_6x10[];
+
+class U8G2 {
+public:
+    U8G2();
+    virtual ~U8G2() {}
+
+    // Lifecycle
+    bool begin();
+    void setI2CAddress(uint8_t address) { i2c_address = address; }
+    void setBusClock(uint32_t clock_speed);
+    void setPowerSave(uint8_t is_enable);
+    void setContrast(uint8_t value);
+
+    // Buffer transfer
+    void clearBuffer();
+    void sendBuffer();
+    void updateDisplay() { sendBuffer(); }
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+    uint8_t* getBufferPtr() { return buffer; }
+    uint8_t getBufferTileWidth() const { return SIM_PANEL_WIDTH / 8; }
+    uint8_t getBufferTileHeight() const { return SIM_PANEL_HEIGHT / 8; }
+    u8g2_uint_t getDisplayWidth() const { return SIM_PANEL_WIDTH; }
+    u8g2_uint_t getDisplayHeight() const { return SIM_PANEL_HEIGHT; }
+
+    // Drawing state
+    void setDrawColor(uint8_t color) { draw_color = color; }
+    uint8_t getDrawColor() const { return draw_color; }
+    void setFont(const uint8_t *font);
+    void setFontMode(uint8_t is_transparent) { font_transparent = is_transparent; }
+    void setFontRefHeightAll() {}   // Sim ascent/descent already span the whole cell
+
+    // Primitives
+    void drawPixel(u8g2_uint_t x, u8g2_uint_t y);
+    void drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w);
+    void drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h);
+    void drawLine(u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2);
+    void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+    void drawFrame(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+    void drawCircle(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt = U8G2_DRAW_ALL);
+    void drawDisc(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt = U8G2_DRAW_ALL);
+    void drawXBM(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+
+    // Text (y is the baseline, as in U8g2)
+    u8g2_uint_t drawStr(u8g2_uint_t x, u8g2_uint_t y, const char *s);
+    u8g2_uint_t getStrWidth(const char *s);
+    int8_t getAscent() const { return font[2]; }
+    int8_t getDescent() const { return (int8_t)(font[2] - font[1]); }
+    uint8_t getMaxCharWidth() const { return font[0]; }
+    uint8_t getMaxCharHeight() const { return font[1]; }
+
+protected:
+    uint8_t buffer[SIM_PANEL_BYTES];
+    uint8_t i2c_address;
+    uint8_t draw_color;
+    uint8_t font_transparent;
+    uint8_t power_save;
+    uint8_t contrast;
+    uint32_t bus_clock;
+    const uint8_t *font;
+
+    void busTransfer(size_t bytes);
+    void setPixel(int16_t x, int16_t y);
+    void circleSection(int16_t x0, int16_t y0, int16_t x, int16_t y, uint8_t opt, bool fill);
+    void drawGlyph(int16_t x, int16_t y, char c);
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2 {
+public:
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C(const u8g2_cb_t *rotation,
+                                         uint8_t reset = U8X8_PIN_NONE,
+                                         uint8_t clock = U8X8_PIN_NONE,
+                                         uint8_t data = U8X8_PIN_NONE);
+};
+
+#endif // IONOS_SIM_U8G2LIB_H
@@ -0,0 +1,41 @@
+#ifndef IONOS_SIM_WIRE_H
+#define IONOS_SIM_WIRE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED I2C (native host build)
+// TwoWire front-end for the SimHAL I2C bus and its attached devices
+// ============================================================================
+
+class TwoWire {
+public:
+    bool begin();
+    bool begin(int sda, int scl, uint32_t frequency = 0);
+    void end() {}
+    void setClock(uint32_t frequency);
+
+    void beginTransmission(uint16_t address);
+    uint8_t endTransmission(bool send_stop = true);
+    uint8_t requestFrom(uint16_t address, uint8_t quantity, bool send_stop = true);
+
+    size_t write(uint8_t data);
+    size_t write(const uint8_t *data, size_t len);
+    int available();
+    int read();
+
+private:
+    static const size_t BUFFER_SIZE = 128;
+
+    uint16_t tx_address = 0;
+    uint8_t tx_buffer[BUFFER_SIZE];
+    size_t tx_len = 0;
+    uint8_t rx_buffer[BUFFER_SIZE];
+    size_t rx_len = 0;
+    size_t rx_pos = 0;
+};
+
+extern TwoWire Wire;
+
+#endif // IONOS_SIM_WIRE_H
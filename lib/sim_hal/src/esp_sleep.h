@@ -0,0 +1,39 @@
+#ifndef IONOS_SIM_ESP_SLEEP_H
+#define IONOS_SIM_ESP_SLEEP_H
+
+#include <stdint.h>
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED ESP-IDF SLEEP API (native host build)
+// Sleep calls return immediately; timer wake-ups advance simulated time
+// ============================================================================
+
+typedef enum {
+    GPIO_NUM_NC = -1,
+    GPIO_NUM_0 = 0,
+    GPIO_NUM_MAX = 40
+} gpio_num_t;
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED = 0,
+    ESP_SLEEP_WAKEUP_ALL,
+    ESP_SLEEP_WAKEUP_EXT0,
+    ESP_SLEEP_WAKEUP_EXT1,
+    ESP_SLEEP_WAKEUP_TIMER,
+    ESP_SLEEP_WAKEUP_TOUCHPAD,
+    ESP_SLEEP_WAKEUP_ULP,
+    ESP_SLEEP_WAKEUP_GPIO,
+    ESP_SLEEP_WAKEUP_UART
+} esp_sleep_source_t;
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us);
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level);
+esp_err_t esp_sleep_enable_uart_wakeup(int uart_num);
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source);
+esp_err_t esp_light_sleep_start();
+void esp_deep_sleep_start();
+
+#endif // IONOS_SIM_ESP_SLEEP_H
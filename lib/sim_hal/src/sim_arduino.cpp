@@ -0,0 +1,504 @@
+#include "Arduino.h"
+#include "sim_hal.h"
+#include <stdarg.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sched.h>
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED ARDUINO CORE IMPLEMENTATION (native host build)
+// Virtual clock, GPIO/ADC models, stdio serial, heap model, sim entry point
+// ============================================================================
+
+HardwareSerial Serial;
+EspClass ESP;
+
+void simResetI2C();
+void simResetStorage();
+
+// Sketch entry points (src/main.cpp)
+void setup();
+void loop();
+
+static const uint32_t SIM_HEAP_SIZE = 327680;
+static const uint32_t SIM_DEFAULT_FREE_HEAP = 300000;
+static const uint16_t SIM_DEFAULT_ADC_MV = 3000;
+
+static bool realtime = false;
+static uint64_t virtual_offset_us = 0;
+static uint64_t boot_time_us = 0;
+
+static uint8_t pin_mode[SIM_NUM_PINS];
+static uint8_t pin_output[SIM_NUM_PINS];
+static int pin_external[SIM_NUM_PINS];
+static uint16_t pin_millivolts[SIM_NUM_PINS];
+
+struct SimPinInterrupt {
+    void (*isr)(void*);
+    void (*isr_noarg)(void);
+    void *arg;
+    int mode;
+};
+static SimPinInterrupt pin_interrupt[SIM_NUM_PINS];
+
+static uint8_t panel[SIM_PANEL_BYTES];
+
+static uint32_t free_heap = SIM_DEFAULT_FREE_HEAP;
+static uint32_t min_free_heap = SIM_DEFAULT_FREE_HEAP;
+static uint32_t largest_free_block = SIM_DEFAULT_FREE_HEAP;
+
+static bool exit_requested = false;
+static int exit_code = 0;
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Timing (host monotonic clock + virtual offset advanced by delay())
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static uint64_t hostMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static uint64_t simMicros() {
+    if (boot_time_us == 0) {
+        boot_time_us = hostMicros();
+    }
+    return hostMicros() - boot_time_us + virtual_offset_us;
+}
+
+uint32_t millis() {
+    return (uint32_t)(simMicros() / 1000);
+}
+
+uint32_t micros() {
+    return (uint32_t)simMicros();
+}
+
+void delay(uint32_t ms) {
+    delayMicroseconds(ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us) {
+    if (realtime) {
+        usleep(us);
+    } else {
+        virtual_offset_us += us;
+    }
+}
+
+void yield() {
+    // Let other host threads (e.g. stress-test producers) run
+    sched_yield();
+}
+
+// Used by the bus models to charge blocking transfer time
+void simAdvanceMicros(uint64_t us) {
+    virtual_offset_us += us;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// GPIO and ADC
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= SIM_NUM_PINS) return;
+    pin_mode[pin] = mode;
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin >= SIM_NUM_PINS) return LOW;
+
+    if (pin_external[pin] >= 0) {
+        return pin_external[pin] ? HIGH : LOW;
+    }
+    if (pin_mode[pin] == OUTPUT) {
+        return pin_output[pin];
+    }
+    return pin_mode[pin] == INPUT_PULLUP ? HIGH : LOW;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+    if (pin >= SIM_NUM_PINS) return;
+    pin_interrupt[pin].isr = nullptr;
+    pin_interrupt[pin].isr_noarg = isr;
+    pin_interrupt[pin].arg = nullptr;
+    pin_interrupt[pin].mode = mode;
+}
+
+void attachInterruptArg(uint8_t pin, void (*isr)(void*), void *arg, int mode) {
+    if (pin >= SIM_NUM_PINS) return;
+    pin_interrupt[pin].isr = isr;
+    pin_interrupt[pin].isr_noarg = nullptr;
+    pin_interrupt[pin].arg = arg;
+    pin_interrupt[pin].mode = mode;
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin >= SIM_NUM_PINS) return;
+    memset(&pin_interrupt[pin], 0, sizeof(pin_interrupt[pin]));
+}
+
+// Run the pin's ISR synchronously if the edge matches its trigger mode
+static void fireInterrupt(uint8_t pin, int old_level, int new_level) {
+    const SimPinInterrupt &irq = pin_interrupt[pin];
+    if (old_level == new_level) return;
+    if (irq.mode == RISING && new_level != HIGH) return;
+    if (irq.mode == FALLING && new_level != LOW) return;
+
+    if (irq.isr != nullptr) {
+        irq.isr(irq.arg);
+    } else if (irq.isr_noarg != nullptr) {
+        irq.isr_noarg();
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    if (pin >= SIM_NUM_PINS) return;
+    pin_output[pin] = val ? HIGH : LOW;
+}
+
+uint16_t analogRead(uint8_t pin) {
+    if (pin >= SIM_NUM_PINS) return 0;
+    uint32_t raw = (uint32_t)pin_millivolts[pin] * 4095 / 3300;
+    return raw > 4095 ? 4095 : (uint16_t)raw;
+}
+
+void analogSetPinAttenuation(uint8_t pin, adc_attenuation_t attenuation) {
+    (void)pin;
+    (void)attenuation;
+}
+
+void analogSetClockDiv(uint8_t clock_div) {
+    (void)clock_div;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// String
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void String::trim() {
+    const char *ws = " \t\r\n";
+    size_t start = value.find_first_not_of(ws);
+    if (start == std::string::npos) {
+        value.clear();
+        return;
+    }
+    size_t end = value.find_last_not_of(ws);
+    value = value.substr(start, end - start + 1);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Serial (stdout, non-blocking stdin)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static int serial_peek = -1;
+static bool stdin_closed = false;
+
+void HardwareSerial::begin(unsigned long baud) {
+    (void)baud;
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+}
+
+void HardwareSerial::flush() {
+    fflush(stdout);
+}
+
+int HardwareSerial::available() {
+    if (serial_peek >= 0) return 1;
+    if (stdin_closed) return 0;
+
+    struct pollfd pfd = { STDIN_FILENO, POLLIN, 0 };
+    if (poll(&pfd, 1, 0) <= 0 || !(pfd.revents & (POLLIN | POLLHUP))) {
+        return 0;
+    }
+
+    uint8_t c;
+    if (::read(STDIN_FILENO, &c, 1) != 1) {
+        stdin_closed = true;
+        return 0;
+    }
+    serial_peek = c;
+    return 1;
+}
+
+int HardwareSerial::read() {
+    if (!available()) return -1;
+    int c = serial_peek;
+    serial_peek = -1;
+    return c;
+}
+
+String HardwareSerial::readStringUntil(char terminator) {
+    String result;
+    while (available()) {
+        int c = read();
+        if (c == terminator) break;
+        result += (char)c;
+    }
+    return result;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+    return fwrite(buffer, 1, size, stdout);
+}
+
+size_t HardwareSerial::print(const char *str) {
+    return fputs(str, stdout) < 0 ? 0 : strlen(str);
+}
+
+size_t HardwareSerial::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t HardwareSerial::print(int value) {
+    return printf("%d", value);
+}
+
+size_t HardwareSerial::print(unsigned int value) {
+    return printf("%u", value);
+}
+
+size_t HardwareSerial::print(long value) {
+    return printf("%ld", value);
+}
+
+size_t HardwareSerial::print(unsigned long value) {
+    return printf("%lu", value);
+}
+
+size_t HardwareSerial::print(double value, int digits) {
+    return printf("%.*f", digits, value);
+}
+
+size_t HardwareSerial::println() {
+    return print("\r\n");
+}
+
+size_t HardwareSerial::printf(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n < 0 ? 0 : (size_t)n;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// ESP heap model
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t EspClass::getFreeHeap() {
+    return free_heap;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+    return min_free_heap;
+}
+
+uint32_t EspClass::getHeapSize() {
+    return SIM_HEAP_SIZE;
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+    return largest_free_block < free_heap ? largest_free_block : free_heap;
+}
+
+uint32_t EspClass::getFreePsram() {
+    return 0;
+}
+
+void EspClass::restart() {
+    Serial.println("[SIM] Restart requested, exiting");
+    fflush(stdout);
+    exit(exit_code);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// ESP-IDF sleep API
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static uint64_t sleep_timer_us = 0;
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+    sleep_timer_us = time_in_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level) {
+    (void)gpio_num;
+    (void)level;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_uart_wakeup(int uart_num) {
+    (void)uart_num;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source) {
+    if (source == ESP_SLEEP_WAKEUP_TIMER || source == ESP_SLEEP_WAKEUP_ALL) {
+        sleep_timer_us = 0;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start() {
+    // Wake immediately on a pending source; the timer source skips ahead
+    virtual_offset_us += sleep_timer_us;
+    return ESP_OK;
+}
+
+void esp_deep_sleep_start() {
+    Serial.println("[SIM] Deep sleep entered, exiting");
+    fflush(stdout);
+    exit(exit_code);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// SimHAL control interface
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void SimHAL::reset() {
+    boot_time_us = hostMicros();
+    virtual_offset_us = 0;
+    sleep_timer_us = 0;
+
+    for (int i = 0; i < SIM_NUM_PINS; i++) {
+        pin_mode[i] = INPUT;
+        pin_output[i] = LOW;
+        pin_external[i] = -1;
+        pin_millivolts[i] = SIM_DEFAULT_ADC_MV;
+    }
+    memset(pin_interrupt, 0, sizeof(pin_interrupt));
+
+    memset(panel, 0, sizeof(panel));
+    free_heap = SIM_DEFAULT_FREE_HEAP;
+    min_free_heap = SIM_DEFAULT_FREE_HEAP;
+    largest_free_block = SIM_DEFAULT_FREE_HEAP;
+    exit_requested = false;
+    exit_code = 0;
+
+    simResetI2C();
+    simResetStorage();
+}
+
+void SimHAL::setRealtime(bool enable) {
+    realtime = enable;
+}
+
+bool SimHAL::isRealtime() {
+    return realtime;
+}
+
+void SimHAL::advanceTime(uint32_t ms) {
+    virtual_offset_us += (uint64_t)ms * 1000;
+}
+
+void SimHAL::setPin(uint8_t pin, int level) {
+    if (pin >= SIM_NUM_PINS) return;
+    int old_level = digitalRead(pin);
+    pin_external[pin] = level < 0 ? -1 : (level ? HIGH : LOW);
+    fireInterrupt(pin, old_level, digitalRead(pin));
+}
+
+int SimHAL::getPinOutput(uint8_t pin) {
+    if (pin >= SIM_NUM_PINS) return LOW;
+    return pin_output[pin];
+}
+
+void SimHAL::setAnalogMillivolts(uint8_t pin, uint16_t mv) {
+    if (pin >= SIM_NUM_PINS) return;
+    pin_millivolts[pin] = mv;
+}
+
+uint8_t* SimHAL::getPanel() {
+    return panel;
+}
+
+bool SimHAL::getPanelPixel(uint8_t x, uint8_t y) {
+    if (x >= SIM_PANEL_WIDTH || y >= SIM_PANEL_HEIGHT) return false;
+    return panel[(y / 8) * SIM_PANEL_WIDTH + x] & (1 << (y % 8));
+}
+
+void SimHAL::dumpPanel() {
+    // Two pixel rows per text line using half-block characters
+    printf("+");
+    for (int x = 0; x < SIM_PANEL_WIDTH; x++) printf("-");
+    printf("+\n");
+
+    for (int y = 0; y < SIM_PANEL_HEIGHT; y += 2) {
+        printf("|");
+        for (int x = 0; x < SIM_PANEL_WIDTH; x++) {
+            bool top = getPanelPixel(x, y);
+            bool bottom = getPanelPixel(x, y + 1);
+            if (top && bottom) printf("\xe2\x96\x88");
+            else if (top) printf("\xe2\x96\x80");
+            else if (bottom) printf("\xe2\x96\x84");
+            else printf(" ");
+        }
+        printf("|\n");
+    }
+
+    printf("+");
+    for (int x = 0; x < SIM_PANEL_WIDTH; x++) printf("-");
+    printf("+\n");
+}
+
+void SimHAL::setFreeHeap(uint32_t bytes) {
+    free_heap = bytes;
+    largest_free_block = bytes;
+    if (bytes < min_free_heap) {
+        min_free_heap = bytes;
+    }
+}
+
+void SimHAL::setLargestFreeBlock(uint32_t bytes) {
+    largest_free_block = bytes;
+}
+
+void SimHAL::requestExit(int code) {
+    exit_requested = true;
+    exit_code = code;
+}
+
+bool SimHAL::exitRequested() {
+    return exit_requested;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Host entry point
+// Usage: program [--ticks N] [--realtime] [--dump]
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+int main(int argc, char **argv) {
+    uint32_t max_ticks = 0;  // 0 = run until exit is requested
+    bool dump = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            max_ticks = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--realtime") == 0) {
+            realtime = true;
+        } else if (strcmp(argv[i], "--dump") == 0) {
+            dump = true;
+        } else {
+            fprintf(stderr, "usage: %s [--ticks N] [--realtime] [--dump]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    SimHAL::reset();
+    setup();
+
+    for (uint32_t ticks = 0; !exit_requested && (max_ticks == 0 || ticks < max_ticks); ticks++) {
+        loop();
+    }
+
+    if (dump) {
+        SimHAL::dumpPanel();
+    }
+
+    const SimBusStats &stats = SimHAL::getBusStats();
+    printf("[SIM] %lu ms simulated, %lu I2C bytes, %lu full / %lu partial flushes\n",
+           (unsigned long)millis(), (unsigned long)stats.bytes,
+           (unsigned long)stats.full_flushes, (unsigned long)stats.partial_flushes);
+
+    return exit_code;
+}
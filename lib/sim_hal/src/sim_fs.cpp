@@ -0,0 +1,478 @@
+#include "FS.h"
+#include "SD.h"
+#include "LittleFS.h"
+#include "Arduino.h"
+#include "sim_hal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED FILESYSTEM IMPLEMENTATION (native host build)
+// Host directories as volumes, per-device cost models and traffic accounting
+// ============================================================================
+
+void simAdvanceMicros(uint64_t us);
+
+// How a volume's device spends time. Blocks are the unit the device moves
+// (SD sectors, flash read lines); a call that stays in the block it last
+// touched is served from the driver's buffer.
+struct SimVolumeTiming {
+    uint32_t call_us;           // Driver overhead per call
+    uint32_t command_us;        // Per transfer: command, access latency
+    uint32_t block_bytes;
+    uint32_t block_overhead;    // Framing bytes clocked with each block
+    uint32_t bus_hz;
+    uint8_t bus_width;          // Bits per clock
+    uint32_t program_us;        // Extra per block written
+    uint32_t dir_blocks;        // Metadata walked per open/lookup
+};
+
+struct SimVolume {
+    const char *default_root;
+    const char *root_env;
+    std::string root;
+    bool present;
+    bool mounted;
+    uint64_t capacity;          // 0 = the host filesystem's size
+    SimVolumeTiming timing;
+    SimStorageStats stats;
+};
+
+// SD card on the SPI bus: one multi-block command, each sector is
+// data + CRC + start token
+static const SimVolumeTiming SIM_SD_TIMING = { 15, 120, 512, 3, 4000000, 1, 0, 2 };
+
+// LittleFS on the internal flash (DIO, 40 MHz): no access latency worth
+// counting on reads, ~0.7 ms per 256-byte page program
+static const SimVolumeTiming SIM_FLASH_TIMING = { 30, 2, 512, 0, 40000000, 2, 1400, 1 };
+
+static const SimVolumeTiming SIM_HOST_TIMING = { 0, 0, 512, 0, 1, 1, 0, 0 };
+
+static SimVolume sd_volume = {
+    "sim_sd", "IONOS_SD_ROOT", "", true, false,
+    2ULL * 1024 * 1024 * 1024, SIM_SD_TIMING, {}
+};
+
+// The "spiffs" partition of default.csv
+static SimVolume flash_volume = {
+    "sim_flash", "IONOS_FLASH_ROOT", "", true, false,
+    0x160000, SIM_FLASH_TIMING, {}
+};
+
+fs::SDFS SD;
+fs::LittleFSFS LittleFS;
+
+struct SimFileImpl {
+    SimVolume *volume = nullptr;
+    FILE *fp = nullptr;
+    DIR *dir = nullptr;
+    std::string path;           // Volume path ("/logs/a.txt")
+    std::string name;           // Last path component
+    uint32_t last_block = UINT32_MAX;
+
+    ~SimFileImpl() {
+        if (fp) fclose(fp);
+        if (dir) closedir(dir);
+    }
+};
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Cost model
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+static void chargeCall(SimVolume *volume) {
+    volume->stats.calls++;
+    volume->stats.bus_time_us += volume->timing.call_us;
+    simAdvanceMicros(volume->timing.call_us);
+}
+
+static void chargeBlocks(SimVolume *volume, uint32_t count, bool writing) {
+    if (count == 0) return;
+
+    const SimVolumeTiming &timing = volume->timing;
+    uint64_t clocks = (uint64_t)count * (timing.block_bytes + timing.block_overhead) * 8 / timing.bus_width;
+    uint64_t us = timing.command_us + clocks * 1000000ULL / timing.bus_hz;
+    if (writing) us += (uint64_t)count * timing.program_us;
+    volume->stats.commands++;
+    volume->stats.sectors += count;
+    volume->stats.bus_time_us += us;
+    simAdvanceMicros(us);
+}
+
+// Charge the blocks [pos, pos + len) that are not the one already buffered
+static void chargeSpan(SimFileImpl *impl, uint32_t pos, size_t len, bool writing) {
+    if (len == 0) return;
+    uint32_t block = impl->volume->timing.block_bytes;
+    uint32_t first = pos / block;
+    uint32_t last = (uint32_t)((pos + len - 1) / block);
+    if (first == impl->last_block) first++;
+    if (last >= first) chargeBlocks(impl->volume, last - first + 1, writing);
+    impl->last_block = last;
+}
+
+static void chargeLookup(SimVolume *volume) {
+    chargeCall(volume);
+    chargeBlocks(volume, volume->timing.dir_blocks, false);
+}
+
+static std::string hostPath(SimVolume *volume, const char *path) {
+    std::string host = volume->root;
+    if (path == nullptr || path[0] != '/') host += "/";
+    if (path != nullptr) host += path;
+    return host;
+}
+
+static bool mountVolume(SimVolume *volume) {
+    if (!volume->present) return false;
+
+    ::mkdir(volume->root.c_str(), 0755);
+    struct stat st;
+    volume->mounted = stat(volume->root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    return volume->mounted;
+}
+
+static uint64_t treeBytes(const std::string &dir_path) {
+    uint64_t total = 0;
+    DIR *dir = opendir(dir_path.c_str());
+    if (dir == nullptr) return 0;
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+        std::string child = dir_path + "/" + entry->d_name;
+        struct stat st;
+        if (stat(child.c_str(), &st) != 0) continue;
+        total += S_ISDIR(st.st_mode) ? treeBytes(child) : (uint64_t)st.st_size;
+    }
+    closedir(dir);
+    return total;
+}
+
+static uint64_t volumeTotal(SimVolume *volume) {
+    if (!volume->mounted) return 0;
+    if (volume->capacity > 0) return volume->capacity;
+
+    struct statvfs vfs;
+    if (statvfs(volume->root.c_str(), &vfs) != 0) return 0;
+    return (uint64_t)vfs.f_blocks * vfs.f_frsize;
+}
+
+static uint64_t volumeUsed(SimVolume *volume) {
+    return volume->mounted ? treeBytes(volume->root) : 0;
+}
+
+static void resetVolume(SimVolume *volume, const SimVolumeTiming &timing) {
+    const char *root = getenv(volume->root_env);
+    volume->root = root ? root : volume->default_root;
+    volume->present = true;
+    volume->mounted = false;
+    volume->timing = timing;
+    memset(&volume->stats, 0, sizeof(volume->stats));
+}
+
+static void setVolumeRoot(SimVolume *volume, const char *path) {
+    volume->root = path ? path : volume->default_root;
+    while (volume->root.size() > 1 && volume->root.back() == '/') volume->root.pop_back();
+}
+
+namespace fs {
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// File
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+size_t File::read(uint8_t *buf, size_t size) {
+    if (!impl || !impl->fp || size == 0) return 0;
+    chargeCall(impl->volume);
+    uint32_t pos = (uint32_t)ftell(impl->fp);
+    size_t got = fread(buf, 1, size, impl->fp);
+    chargeSpan(impl.get(), pos, got, false);
+    impl->volume->stats.bytes += got;
+    return got;
+}
+
+int File::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+    if (!impl || !impl->fp) return -1;
+    int c = fgetc(impl->fp);
+    if (c != EOF) ungetc(c, impl->fp);
+    return c;
+}
+
+int File::available() {
+    if (!impl || !impl->fp) return 0;
+    return (int)(size() - position());
+}
+
+size_t File::write(const uint8_t *buf, size_t size) {
+    if (!impl || !impl->fp || size == 0) return 0;
+    chargeCall(impl->volume);
+    uint32_t pos = (uint32_t)ftell(impl->fp);
+    size_t put = fwrite(buf, 1, size, impl->fp);
+    fflush(impl->fp);
+    chargeSpan(impl.get(), pos, put, true);
+    impl->volume->stats.bytes += put;
+    return put;
+}
+
+size_t File::print(const char *str) {
+    return str ? write((const uint8_t*)str, strlen(str)) : 0;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!impl || !impl->fp) return false;
+    int whence = mode == SeekCur ? SEEK_CUR : mode == SeekEnd ? SEEK_END : SEEK_SET;
+    return fseek(impl->fp, (long)pos, whence) == 0;
+}
+
+size_t File::position() const {
+    if (!impl || !impl->fp) return 0;
+    return (size_t)ftell(impl->fp);
+}
+
+size_t File::size() const {
+    if (!impl) return 0;
+    struct stat st;
+    if (impl->fp) {
+        return fstat(fileno(impl->fp), &st) == 0 ? (size_t)st.st_size : 0;
+    }
+    return 0;
+}
+
+void File::close() {
+    impl.reset();
+}
+
+const char* File::name() const {
+    return impl ? impl->name.c_str() : "";
+}
+
+const char* File::path() const {
+    return impl ? impl->path.c_str() : "";
+}
+
+bool File::isDirectory() const {
+    return impl && impl->dir != nullptr;
+}
+
+File File::openNextFile(const char *mode) {
+    if (!impl || !impl->dir) return File();
+
+    struct dirent *entry;
+    while ((entry = readdir(impl->dir)) != nullptr) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+        std::string child = impl->path;
+        if (child.empty() || child.back() != '/') child += "/";
+        child += entry->d_name;
+        return FS(impl->volume).open(child.c_str(), mode);
+    }
+    return File();
+}
+
+File::operator bool() const {
+    return impl && (impl->fp || impl->dir);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// FS
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+File FS::open(const char *path, const char *mode, const bool create) {
+    (void)create;
+    if (!volume->mounted || path == nullptr) return File();
+    chargeLookup(volume);
+
+    std::string host = hostPath(volume, path);
+    auto impl = std::make_shared<SimFileImpl>();
+    impl->volume = volume;
+    impl->path = path;
+    const char *slash = strrchr(path, '/');
+    impl->name = slash ? slash + 1 : path;
+
+    struct stat st;
+    bool exists = stat(host.c_str(), &st) == 0;
+    if (exists && S_ISDIR(st.st_mode)) {
+        impl->dir = opendir(host.c_str());
+        return impl->dir ? File(impl) : File();
+    }
+
+    if (strcmp(mode, FILE_READ) == 0) {
+        if (!exists) return File();
+        impl->fp = fopen(host.c_str(), "rb");
+    } else if (strcmp(mode, FILE_APPEND) == 0) {
+        impl->fp = fopen(host.c_str(), "ab");
+    } else {
+        impl->fp = fopen(host.c_str(), "wb");
+    }
+    if (impl->fp == nullptr) return File();
+
+    volume->stats.opens++;
+    return File(impl);
+}
+
+bool FS::exists(const char *path) {
+    if (!volume->mounted || path == nullptr) return false;
+    chargeLookup(volume);
+    struct stat st;
+    return stat(hostPath(volume, path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char *path) {
+    if (!volume->mounted || path == nullptr) return false;
+    chargeLookup(volume);
+    return unlink(hostPath(volume, path).c_str()) == 0;
+}
+
+bool FS::rename(const char *path_from, const char *path_to) {
+    if (!volume->mounted || path_from == nullptr || path_to == nullptr) return false;
+    chargeLookup(volume);
+    return ::rename(hostPath(volume, path_from).c_str(), hostPath(volume, path_to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char *path) {
+    if (!volume->mounted || path == nullptr) return false;
+    chargeLookup(volume);
+    return ::mkdir(hostPath(volume, path).c_str(), 0755) == 0;
+}
+
+bool FS::rmdir(const char *path) {
+    if (!volume->mounted || path == nullptr) return false;
+    chargeLookup(volume);
+    return ::rmdir(hostPath(volume, path).c_str()) == 0;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Volumes
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+SDFS::SDFS() : FS(&sd_volume) {
+}
+
+bool SDFS::begin(uint8_t ss_pin) {
+    (void)ss_pin;
+    return mountVolume(volume);
+}
+
+void SDFS::end() {
+    volume->mounted = false;
+}
+
+sdcard_type_t SDFS::cardType() {
+    return volume->mounted ? CARD_SDHC : CARD_NONE;
+}
+
+uint64_t SDFS::cardSize() {
+    return volumeTotal(volume);
+}
+
+uint64_t SDFS::totalBytes() {
+    return volumeTotal(volume);
+}
+
+uint64_t SDFS::usedBytes() {
+    return volumeUsed(volume);
+}
+
+LittleFSFS::LittleFSFS() : FS(&flash_volume) {
+}
+
+bool LittleFSFS::begin(bool format_on_fail, const char *base_path,
+                       uint8_t max_open_files, const char *partition_label) {
+    (void)format_on_fail;
+    (void)base_path;
+    (void)max_open_files;
+    (void)partition_label;
+    return mountVolume(volume);
+}
+
+void LittleFSFS::end() {
+    volume->mounted = false;
+}
+
+uint64_t LittleFSFS::totalBytes() {
+    return volumeTotal(volume);
+}
+
+uint64_t LittleFSFS::usedBytes() {
+    return volumeUsed(volume);
+}
+
+HostFS::HostFS(const char *root) : FS(new SimVolume()) {
+    volume->default_root = ".";
+    volume->root_env = "";
+    volume->present = true;
+    volume->mounted = false;
+    volume->capacity = 0;
+    volume->timing = SIM_HOST_TIMING;
+    memset(&volume->stats, 0, sizeof(volume->stats));
+    setVolumeRoot(volume, root);
+}
+
+HostFS::~HostFS() {
+    delete volume;
+}
+
+bool HostFS::begin() {
+    return mountVolume(volume);
+}
+
+void HostFS::end() {
+    volume->mounted = false;
+}
+
+uint64_t HostFS::totalBytes() {
+    return volumeTotal(volume);
+}
+
+uint64_t HostFS::usedBytes() {
+    return volumeUsed(volume);
+}
+
+} // namespace fs
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// SimHAL control
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void simResetStorage() {
+    resetVolume(&sd_volume, SIM_SD_TIMING);
+    resetVolume(&flash_volume, SIM_FLASH_TIMING);
+}
+
+void SimHAL::setSDRoot(const char *path) {
+    setVolumeRoot(&sd_volume, path);
+}
+
+void SimHAL::setSDPresent(bool present) {
+    sd_volume.present = present;
+    if (!present) sd_volume.mounted = false;
+}
+
+void SimHAL::setSDClock(uint32_t freq) {
+    if (freq > 0) sd_volume.timing.bus_hz = freq;
+}
+
+const SimStorageStats& SimHAL::getStorageStats() {
+    return sd_volume.stats;
+}
+
+void SimHAL::resetStorageStats() {
+    memset(&sd_volume.stats, 0, sizeof(sd_volume.stats));
+}
+
+void SimHAL::setFlashRoot(const char *path) {
+    setVolumeRoot(&flash_volume, path);
+}
+
+const SimStorageStats& SimHAL::getFlashStats() {
+    return flash_volume.stats;
+}
+
+void SimHAL::resetFlashStats() {
+    memset(&flash_volume.stats, 0, sizeof(flash_volume.stats));
+}
@@ -0,0 +1,102 @@
+#ifndef IONOS_SIM_HAL_H
+#define IONOS_SIM_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED HAL CONTROL INTERFACE (native host build)
+// Lets host-side harnesses drive inputs and inspect simulated hardware
+// ============================================================================
+
+#define SIM_NUM_PINS 40
+#define SIM_PANEL_WIDTH 128
+#define SIM_PANEL_HEIGHT 64
+#define SIM_PANEL_BYTES (SIM_PANEL_WIDTH * SIM_PANEL_HEIGHT / 8)
+
+#define SIM_SSD1306_ADDR 0x3C
+#define SIM_DS3231_ADDR 0x68
+
+// I2C slave model attached to the simulated bus
+class SimI2CDevice {
+public:
+    virtual ~SimI2CDevice() {}
+    virtual void onWrite(const uint8_t *data, size_t len) = 0;
+    virtual size_t onRead(uint8_t *data, size_t len) = 0;
+};
+
+// Bus and panel traffic counters
+struct SimBusStats {
+    uint32_t transactions;     // Completed I2C transactions
+    uint32_t bytes;            // Payload bytes clocked over the bus
+    uint64_t bus_time_us;      // Bus occupancy at the configured clock
+    uint32_t full_flushes;     // sendBuffer() calls
+    uint32_t partial_flushes;  // updateDisplayArea() calls
+};
+
+// Storage device traffic counters (SD card or flash partition)
+struct SimStorageStats {
+    uint32_t calls;            // File/FS calls that reached the device driver
+    uint32_t commands;         // Read/write transfers issued
+    uint32_t sectors;          // 512-byte blocks moved over the bus
+    uint32_t bytes;            // Bytes handed to / taken from callers
+    uint32_t opens;            // Files opened
+    uint64_t bus_time_us;      // Device time charged to the virtual clock
+};
+
+class SimHAL {
+public:
+    // Reset all simulated peripherals to power-on state
+    static void reset();
+
+    // Timing: delay() warps simulated time unless realtime is enabled
+    static void setRealtime(bool realtime);
+    static bool isRealtime();
+    static void advanceTime(uint32_t ms);
+
+    // GPIO: drive an input pin externally (-1 releases it to its pull)
+    static void setPin(uint8_t pin, int level);
+    static int getPinOutput(uint8_t pin);
+
+    // ADC: voltage seen at an analog pin
+    static void setAnalogMillivolts(uint8_t pin, uint16_t mv);
+
+    // I2C bus
+    static void attachI2CDevice(uint8_t address, SimI2CDevice *device);
+    static void detachI2CDevice(uint8_t address);
+    static SimI2CDevice* getI2CDevice(uint8_t address);
+    static void setI2CClock(uint32_t freq);
+    static void recordI2CTransfer(size_t bytes);
+    static const SimBusStats& getBusStats();
+    static void resetBusStats();
+
+    // Panel: what the SSD1306 is currently showing (page-major, 8 pages)
+    static uint8_t* getPanel();
+    static void recordPanelFlush(bool full);
+    static bool getPanelPixel(uint8_t x, uint8_t y);
+    static void dumpPanel();
+
+    // SD card: a host directory stands in for the card (default: the
+    // IONOS_SD_ROOT environment variable, else ./sim_sd)
+    static void setSDRoot(const char *path);
+    static void setSDPresent(bool present);
+    static void setSDClock(uint32_t freq);
+    static const SimStorageStats& getStorageStats();
+    static void resetStorageStats();
+
+    // Flash (LittleFS) partition: another host directory (default: the
+    // IONOS_FLASH_ROOT environment variable, else ./sim_flash)
+    static void setFlashRoot(const char *path);
+    static const SimStorageStats& getFlashStats();
+    static void resetFlashStats();
+
+    // Heap model reported through ESP.getFreeHeap() / getMaxAllocHeap()
+    static void setFreeHeap(uint32_t bytes);          // Also unfragments the heap
+    static void setLargestFreeBlock(uint32_t bytes);
+
+    // Harness control
+    static void requestExit(int code);
+    static bool exitRequested();
+};
+
+#endif // IONOS_SIM_HAL_H
@@ -0,0 +1,295 @@
+#include "U8g2lib.h"
+#include "Arduino.h"
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED U8G2 IMPLEMENTATION (native host build)
+// ============================================================================
+
+const u8g2_cb_t u8g2_cb_r0 = { 0 };
+
+// Cell metrics only: { width, height, ascent }
+const uint8_t u8g2_font_5x8_tf[] = { 5, 8, 6 };
+const uint8_t u8g2_font_6x10_tf[] = { 6, 10, 7 };
+const uint8_t u8g2_font_6x10_mf[] = { 6, 10, 7 };
+const uint8_t u8g2_font_7x14_mf[] = { 7, 14, 10 };
+const uint8_t u8g2_font_9x18_mf[] = { 9, 18, 13 };
+const uint8_t u8g2_font_10x20_mf[] = { 10, 20, 14 };
+const uint8_t u8g2_font_5x8_mn[] = { 5, 8, 6 };
+const uint8_t u8g2_font_6x12_mn[] = { 6, 12, 8 };
+const uint8_t u8g2_font_7x14_mn[] = { 7, 14, 10 };
+const uint8_t u8g2_font_siji_t_6x10[] = { 6, 10, 7 };
+
+// Classic 5x7 ASCII glyphs (0x20-0x7E), column-major, LSB = top row
+static const uint8_t glyphs_5x7[95][5] = {
+    {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+    {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x55,0x22,0x50}, {0x00,0x05,0x03,0x00,0x00},
+    {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x14,0x08,0x3E,0x08,0x14}, {0x08,0x08,0x3E,0x08,0x08},
+    {0x00,0x50,0x30,0x00,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x60,0x60,0x00,0x00}, {0x20,0x10,0x08,0x04,0x02},
+    {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x42,0x61,0x51,0x49,0x46}, {0x21,0x41,0x45,0x4B,0x31},
+    {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x30}, {0x01,0x71,0x09,0x05,0x03},
+    {0x36,0x49,0x49,0x49,0x36}, {0x06,0x49,0x49,0x29,0x1E}, {0x00,0x36,0x36,0x00,0x00}, {0x00,0x56,0x36,0x00,0x00},
+    {0x08,0x14,0x22,0x41,0x00}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x51,0x09,0x06},
+    {0x32,0x49,0x79,0x41,0x3E}, {0x7E,0x11,0x11,0x11,0x7E}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+    {0x7F,0x41,0x41,0x22,0x1C}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x49,0x49,0x7A},
+    {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+    {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x0C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+    {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x46,0x49,0x49,0x49,0x31},
+    {0x01,0x01,0x7F,0x01,0x01}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+    {0x63,0x14,0x08,0x14,0x63}, {0x07,0x08,0x70,0x08,0x07}, {0x61,0x51,0x49,0x45,0x43}, {0x00,0x7F,0x41,0x41,0x00},
+    {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x7F,0x00}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+    {0x00,0x01,0x02,0x04,0x00}, {0x20,0x54,0x54,0x54,0x78}, {0x7F,0x48,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x20},
+    {0x38,0x44,0x44,0x48,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x08,0x7E,0x09,0x01,0x02}, {0x0C,0x52,0x52,0x52,0x3E},
+    {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x44,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},
+    {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x18,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+    {0x7C,0x14,0x14,0x14,0x08}, {0x08,0x14,0x14,0x18,0x7C}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x20},
+    {0x04,0x3F,0x44,0x40,0x20}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},
+    {0x44,0x28,0x10,0x28,0x44}, {0x0C,0x50,0x50,0x50,0x3C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},
+    {0x00,0x00,0x7F,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x10,0x08,0x08,0x10,0x08}
+};
+
+// Bytes per full frame on the wire: control byte + 128 data bytes per page
+static const size_t SSD1306_PAGE_BYTES = SIM_PANEL_WIDTH + 1;
+static const size_t SSD1306_ADDRESSING_BYTES = 6;
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Construction / lifecycle
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+U8G2::U8G2() :
+    i2c_address(SIM_SSD1306_ADDR * 2),
+    draw_color(1),
+    font_transparent(0),
+    power_save(0),
+    contrast(255),
+    bus_clock(400000),
+    font(u8g2_font_6x10_tf) {
+    memset(buffer, 0, sizeof(buffer));
+}
+
+U8G2_SSD1306_128X64_NONAME_F_HW_I2C::U8G2_SSD1306_128X64_NONAME_F_HW_I2C(
+    const u8g2_cb_t *rotation, uint8_t reset, uint8_t clock, uint8_t data) : U8G2() {
+    (void)rotation;
+    (void)reset;
+    (void)clock;
+    (void)data;
+}
+
+bool U8G2::begin() {
+    // Init sequence (~25 command bytes) then a cleared frame
+    busTransfer(25);
+    clearBuffer();
+    sendBuffer();
+    return true;
+}
+
+void U8G2::setBusClock(uint32_t clock_speed) {
+    bus_clock = clock_speed;
+}
+
+// Like the U8g2 Arduino HW I2C callback, re-apply our clock per transfer
+// since other drivers on the shared bus may have changed it
+void U8G2::busTransfer(size_t bytes) {
+    SimHAL::setI2CClock(bus_clock);
+    SimHAL::recordI2CTransfer(bytes);
+}
+
+void U8G2::setPowerSave(uint8_t is_enable) {
+    power_save = is_enable;
+    busTransfer(2);
+}
+
+void U8G2::setContrast(uint8_t value) {
+    contrast = value;
+    busTransfer(3);
+}
+
+void U8G2::setFont(const uint8_t *new_font) {
+    if (new_font != nullptr) {
+        font = new_font;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Buffer transfer
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void U8G2::clearBuffer() {
+    memset(buffer, 0, sizeof(buffer));
+}
+
+void U8G2::sendBuffer() {
+    memcpy(SimHAL::getPanel(), buffer, sizeof(buffer));
+    busTransfer(SSD1306_ADDRESSING_BYTES + SSD1306_PAGE_BYTES * (SIM_PANEL_HEIGHT / 8));
+    SimHAL::recordPanelFlush(true);
+}
+
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+    const uint8_t tiles_x = SIM_PANEL_WIDTH / 8;
+    const uint8_t tiles_y = SIM_PANEL_HEIGHT / 8;
+    if (tx >= tiles_x || ty >= tiles_y) return;
+    if (tx + tw > tiles_x) tw = tiles_x - tx;
+    if (ty + th > tiles_y) th = tiles_y - ty;
+
+    uint8_t *panel = SimHAL::getPanel();
+    for (uint8_t page = ty; page < ty + th; page++) {
+        size_t offset = page * SIM_PANEL_WIDTH + tx * 8;
+        memcpy(panel + offset, buffer + offset, tw * 8);
+        busTransfer(SSD1306_ADDRESSING_BYTES + 1 + tw * 8);
+    }
+    SimHAL::recordPanelFlush(false);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Primitives (color 0 = clear, 1 = set, 2 = XOR)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void U8G2::setPixel(int16_t x, int16_t y) {
+    if (x < 0 || y < 0 || x >= SIM_PANEL_WIDTH || y >= SIM_PANEL_HEIGHT) return;
+
+    uint8_t *cell = &buffer[(y >> 3) * SIM_PANEL_WIDTH + x];
+    uint8_t mask = 1 << (y & 7);
+    switch (draw_color) {
+        case 0: *cell &= ~mask; break;
+        case 1: *cell |= mask; break;
+        default: *cell ^= mask; break;
+    }
+}
+
+void U8G2::drawPixel(u8g2_uint_t x, u8g2_uint_t y) {
+    setPixel(x, y);
+}
+
+void U8G2::drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w) {
+    for (u8g2_uint_t i = 0; i < w; i++) {
+        setPixel(x + i, y);
+    }
+}
+
+void U8G2::drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h) {
+    for (u8g2_uint_t i = 0; i < h; i++) {
+        setPixel(x, y + i);
+    }
+}
+
+void U8G2::drawLine(u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2) {
+    int16_t x = (int16_t)x1;
+    int16_t y = (int16_t)y1;
+    int16_t dx = abs((int16_t)x2 - x);
+    int16_t dy = -abs((int16_t)y2 - y);
+    int16_t sx = x < (int16_t)x2 ? 1 : -1;
+    int16_t sy = y < (int16_t)y2 ? 1 : -1;
+    int16_t err = dx + dy;
+
+    while (true) {
+        setPixel(x, y);
+        if (x == (int16_t)x2 && y == (int16_t)y2) break;
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x += sx; }
+        if (e2 <= dx) { err += dx; y += sy; }
+    }
+}
+
+void U8G2::drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+    for (u8g2_uint_t i = 0; i < h; i++) {
+        drawHLine(x, y + i, w);
+    }
+}
+
+void U8G2::drawFrame(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+    if (w == 0 || h == 0) return;
+    drawHLine(x, y, w);
+    if (h > 1) drawHLine(x, y + h - 1, w);
+    if (h > 2) {
+        drawVLine(x, y + 1, h - 2);
+        if (w > 1) drawVLine(x + w - 1, y + 1, h - 2);
+    }
+}
+
+void U8G2::circleSection(int16_t x0, int16_t y0, int16_t x, int16_t y, uint8_t opt, bool fill) {
+    if (fill) {
+        if (opt & U8G2_DRAW_UPPER_RIGHT) drawVLine(x0 + x, y0 - y, y + 1), drawVLine(x0 + y, y0 - x, x + 1);
+        if (opt & U8G2_DRAW_UPPER_LEFT) drawVLine(x0 - x, y0 - y, y + 1), drawVLine(x0 - y, y0 - x, x + 1);
+        if (opt & U8G2_DRAW_LOWER_RIGHT) drawVLine(x0 + x, y0, y + 1), drawVLine(x0 + y, y0, x + 1);
+        if (opt & U8G2_DRAW_LOWER_LEFT) drawVLine(x0 - x, y0, y + 1), drawVLine(x0 - y, y0, x + 1);
+        return;
+    }
+    if (opt & U8G2_DRAW_UPPER_RIGHT) setPixel(x0 + x, y0 - y), setPixel(x0 + y, y0 - x);
+    if (opt & U8G2_DRAW_UPPER_LEFT) setPixel(x0 - x, y0 - y), setPixel(x0 - y, y0 - x);
+    if (opt & U8G2_DRAW_LOWER_RIGHT) setPixel(x0 + x, y0 + y), setPixel(x0 + y, y0 + x);
+    if (opt & U8G2_DRAW_LOWER_LEFT) setPixel(x0 - x, y0 + y), setPixel(x0 - y, y0 + x);
+}
+
+void U8G2::drawCircle(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt) {
+    int16_t f = 1 - (int16_t)rad;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * (int16_t)rad;
+    int16_t x = 0;
+    int16_t y = rad;
+
+    circleSection(x0, y0, x, y, opt, false);
+    while (x < y) {
+        if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        circleSection(x0, y0, x, y, opt, false);
+    }
+}
+
+void U8G2::drawDisc(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt) {
+    int16_t f = 1 - (int16_t)rad;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * (int16_t)rad;
+    int16_t x = 0;
+    int16_t y = rad;
+
+    circleSection(x0, y0, x, y, opt, true);
+    while (x < y) {
+        if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        circleSection(x0, y0, x, y, opt, true);
+    }
+}
+
+void U8G2::drawXBM(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap) {
+    u8g2_uint_t stride = (w + 7) / 8;
+    for (u8g2_uint_t row = 0; row < h; row++) {
+        for (u8g2_uint_t col = 0; col < w; col++) {
+            if (bitmap[row * stride + col / 8] & (1 << (col & 7))) {
+                setPixel(x + col, y + row);
+            }
+        }
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Text
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void U8G2::drawGlyph(int16_t x, int16_t y, char c) {
+    if (c < 0x20 || c > 0x7E) return;
+
+    const uint8_t *glyph = glyphs_5x7[c - 0x20];
+    int16_t top = y - 7;
+    for (uint8_t col = 0; col < 5; col++) {
+        for (uint8_t row = 0; row < 7; row++) {
+            if (glyph[col] & (1 << row)) {
+                setPixel(x + col, top + row);
+            }
+        }
+    }
+}
+
+u8g2_uint_t U8G2::drawStr(u8g2_uint_t x, u8g2_uint_t y, const char *s) {
+    if (s == nullptr) return 0;
+
+    u8g2_uint_t start = x;
+    for (; *s; s++) {
+        drawGlyph(x, y, *s);
+        x += font[0];
+    }
+    return x - start;
+}
+
+u8g2_uint_t U8G2::getStrWidth(const char *s) {
+    if (s == nullptr) return 0;
+    return (u8g2_uint_t)(strlen(s) * font[0]);
+}
@@ -0,0 +1,258 @@
+#include "Wire.h"
+#include "Arduino.h"
+#include "sim_hal.h"
+#include <time.h>
+
+// ============================================================================
+// ionOS v1.0 - SIMULATED I2C BUS IMPLEMENTATION (native host build)
+// Bus registry, traffic accounting, SSD1306 and DS3231 device models
+// ============================================================================
+
+TwoWire Wire;
+
+void simAdvanceMicros(uint64_t us);
+
+static SimI2CDevice *i2c_devices[128] = { nullptr };
+static uint32_t i2c_clock_hz = 100000;
+static SimBusStats bus_stats = { 0, 0, 0, 0, 0 };
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// SSD1306 model (accepts commands; pixels arrive via the U8G2 model)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+class SimSSD1306 : public SimI2CDevice {
+public:
+    void onWrite(const uint8_t *data, size_t len) override {
+        (void)data;
+        (void)len;
+    }
+
+    size_t onRead(uint8_t *data, size_t len) override {
+        // Status byte: display on, controller ready
+        for (size_t i = 0; i < len; i++) data[i] = 0x03;
+        return len;
+    }
+};
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// DS3231 model (BCD time registers that advance with simulated time)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+class SimDS3231 : public SimI2CDevice {
+public:
+    SimDS3231() { reset(); }
+
+    void reset() {
+        memset(regs, 0, sizeof(regs));
+        reg_pointer = 0;
+        epoch_base = time(nullptr);
+        millis_base = millis();
+        regs[REG_CONTROL] = 0x1C;
+        regs[REG_TEMP_MSB] = 25;
+        regs[REG_TEMP_LSB] = 0x40;  // 25.25 C
+    }
+
+    void onWrite(const uint8_t *data, size_t len) override {
+        if (len == 0) return;
+
+        reg_pointer = data[0] % NUM_REGS;
+        bool time_written = false;
+        for (size_t i = 1; i < len; i++) {
+            if (reg_pointer <= REG_YEAR) time_written = true;
+            regs[reg_pointer] = data[i];
+            reg_pointer = (reg_pointer + 1) % NUM_REGS;
+        }
+
+        if (time_written) {
+            latchTime();
+        }
+    }
+
+    size_t onRead(uint8_t *data, size_t len) override {
+        refreshTime();
+        for (size_t i = 0; i < len; i++) {
+            data[i] = regs[reg_pointer];
+            reg_pointer = (reg_pointer + 1) % NUM_REGS;
+        }
+        return len;
+    }
+
+private:
+    static const uint8_t NUM_REGS = 0x13;
+    static const uint8_t REG_YEAR = 0x06;
+    static const uint8_t REG_CONTROL = 0x0E;
+    static const uint8_t REG_TEMP_MSB = 0x11;
+    static const uint8_t REG_TEMP_LSB = 0x12;
+
+    uint8_t regs[NUM_REGS];
+    uint8_t reg_pointer;
+    time_t epoch_base;
+    uint32_t millis_base;
+
+    static uint8_t toBcd(int v) { return (uint8_t)(((v / 10) << 4) | (v % 10)); }
+    static int fromBcd(uint8_t v) { return ((v >> 4) * 10) + (v & 0x0F); }
+
+    void refreshTime() {
+        time_t now = epoch_base + (millis() - millis_base) / 1000;
+        struct tm tm_now;
+        gmtime_r(&now, &tm_now);
+
+        regs[0] = toBcd(tm_now.tm_sec);
+        regs[1] = toBcd(tm_now.tm_min);
+        regs[2] = toBcd(tm_now.tm_hour);
+        regs[3] = toBcd(tm_now.tm_wday);
+        regs[4] = toBcd(tm_now.tm_mday);
+        regs[5] = toBcd(tm_now.tm_mon + 1);
+        regs[6] = toBcd(tm_now.tm_year - 100);
+    }
+
+    void latchTime() {
+        struct tm tm_set = {};
+        tm_set.tm_sec = fromBcd(regs[0] & 0x7F);
+        tm_set.tm_min = fromBcd(regs[1] & 0x7F);
+        tm_set.tm_hour = fromBcd(regs[2] & 0x3F);
+        tm_set.tm_mday = fromBcd(regs[4] & 0x3F);
+        tm_set.tm_mon = fromBcd(regs[5] & 0x1F) - 1;
+        tm_set.tm_year = fromBcd(regs[6]) + 100;
+        epoch_base = timegm(&tm_set);
+        millis_base = millis();
+    }
+};
+
+static SimSSD1306 sim_ssd1306;
+static SimDS3231 sim_ds3231;
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Bus registry and accounting
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void simResetI2C() {
+    for (int i = 0; i < 128; i++) {
+        i2c_devices[i] = nullptr;
+    }
+    sim_ds3231.reset();
+    i2c_devices[SIM_SSD1306_ADDR] = &sim_ssd1306;
+    i2c_devices[SIM_DS3231_ADDR] = &sim_ds3231;
+    i2c_clock_hz = 100000;
+    SimHAL::resetBusStats();
+}
+
+void SimHAL::attachI2CDevice(uint8_t address, SimI2CDevice *device) {
+    i2c_devices[address & 0x7F] = device;
+}
+
+void SimHAL::detachI2CDevice(uint8_t address) {
+    i2c_devices[address & 0x7F] = nullptr;
+}
+
+SimI2CDevice* SimHAL::getI2CDevice(uint8_t address) {
+    return i2c_devices[address & 0x7F];
+}
+
+void SimHAL::setI2CClock(uint32_t freq) {
+    if (freq > 0) {
+        i2c_clock_hz = freq;
+    }
+}
+
+void SimHAL::recordI2CTransfer(size_t bytes) {
+    // Address byte + payload, 9 clocks per byte (8 data + ACK)
+    uint64_t clocks = (uint64_t)(bytes + 1) * 9;
+    bus_stats.transactions++;
+    bus_stats.bytes += bytes;
+    uint64_t bus_us = clocks * 1000000ULL / i2c_clock_hz;
+    bus_stats.bus_time_us += bus_us;
+
+    // The master blocks for the whole transfer, so charge it to the clock
+    simAdvanceMicros(bus_us);
+}
+
+const SimBusStats& SimHAL::getBusStats() {
+    return bus_stats;
+}
+
+void SimHAL::resetBusStats() {
+    memset(&bus_stats, 0, sizeof(bus_stats));
+}
+
+void SimHAL::recordPanelFlush(bool full) {
+    if (full) {
+        bus_stats.full_flushes++;
+    } else {
+        bus_stats.partial_flushes++;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// TwoWire
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool TwoWire::begin() {
+    return true;
+}
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+    (void)sda;
+    (void)scl;
+    SimHAL::setI2CClock(frequency);
+    return true;
+}
+
+void TwoWire::setClock(uint32_t frequency) {
+    SimHAL::setI2CClock(frequency);
+}
+
+void TwoWire::beginTransmission(uint16_t address) {
+    tx_address = address;
+    tx_len = 0;
+}
+
+uint8_t TwoWire::endTransmission(bool send_stop) {
+    (void)send_stop;
+    SimI2CDevice *device = SimHAL::getI2CDevice(tx_address);
+    SimHAL::recordI2CTransfer(tx_len);
+
+    if (device == nullptr) {
+        return 2;  // NACK on address
+    }
+
+    device->onWrite(tx_buffer, tx_len);
+    tx_len = 0;
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint16_t address, uint8_t quantity, bool send_stop) {
+    (void)send_stop;
+    rx_len = 0;
+    rx_pos = 0;
+
+    SimI2CDevice *device = SimHAL::getI2CDevice(address);
+    if (device == nullptr) {
+        SimHAL::recordI2CTransfer(0);
+        return 0;
+    }
+
+    if (quantity > BUFFER_SIZE) quantity = BUFFER_SIZE;
+    rx_len = device->onRead(rx_buffer, quantity);
+    SimHAL::recordI2CTransfer(rx_len);
+    return (uint8_t)rx_len;
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (tx_len >= BUFFER_SIZE) return 0;
+    tx_buffer[tx_len++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t len) {
+    size_t written = 0;
+    while (written < len && write(data[written])) {
+        written++;
+    }
+    return written;
+}
+
+int TwoWire::available() {
+    return (int)(rx_len - rx_pos);
+}
+
+int TwoWire::read() {
+    if (rx_pos >= rx_len) return -1;
+    return rx_buffer[rx_pos++];
+}
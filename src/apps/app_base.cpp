@@ -1,17 +1,29 @@
 #include "app_base.h"
+#include <Arduino.h>
 
-// Constructor
-App::App() : state(APP_STATE_INACTIVE) {}
-
-// Destructor  
-App::~App() {}
+// No snapshot format by default: the app stays in RAM while suspended
+uint16_t App::saveSnapshot(uint8_t *buffer, uint16_t capacity) {
+    (void)buffer;
+    (void)capacity;
+    return 0;
+}
 
-// No-op virtual method (can be overridden)
-void App::handleBackButton() {
-    // Default: go back to launcher
-    // Override in derived classes if needed
+bool App::restoreSnapshot(const uint8_t *data, uint16_t length) {
+    (void)data;
+    (void)length;
+    return false;
 }
 
-AppState App::getState() {
-    return state;
+// Default BACK: let the kernel switch back to the launcher
+bool App::handleBackButton() {
+    Event event = {
+        .type = EVENT_APP_BACK,
+        .priority = PRIORITY_NORMAL,
+        .timestamp = millis(),
+        .data1 = Kernel::getActiveAppID(),
+        .data2 = 0,
+        .data3 = nullptr
+    };
+    Kernel::postEvent(event);
+    return false;
 }
@@ -3,34 +3,40 @@
 
 #include <stdint.h>
 #include "../core/events.h"
+#include "../core/kernel.h"
 
 // ============================================================================
 // ionOS v1.0 - APP BASE CLASS
 // Abstract base for all applications
+//
+// Apps are launched and switched through Kernel::launchApp(). Switching away
+// suspends the app with its state in RAM; switching back calls onResume(),
+// not onLaunch(). Under memory pressure the kernel may ask a suspended app
+// for a snapshot, store it and call onTrim(); restoreSnapshot() then runs
+// before the next onResume().
 // ============================================================================
 
-enum AppState {
-    APP_STATE_INACTIVE = 0,
-    APP_STATE_ACTIVE = 1,
-    APP_STATE_SUSPENDED = 2,
-    APP_STATE_CLOSING = 3
-};
-
 class App {
 public:
     virtual ~App() = default;
 
     // Lifecycle methods
-    virtual void onLaunch() = 0;      // Called when app starts
-    virtual void onSuspend() {}       // Called when app paused
-    virtual void onResume() {}        // Called when app resumed
+    virtual void onLaunch() = 0;      // Called when app starts (cold)
+    virtual void onSuspend() {}       // Called when app goes to the background
+    virtual void onResume() {}        // Called when app comes back to the front
     virtual void onClose() = 0;       // Called when app closes
 
-    // Event handling
-    virtual void onEvent(const Event &event) = 0;
+    // State snapshot (optional, suspended apps only)
+    virtual uint16_t saveSnapshot(uint8_t *buffer, uint16_t capacity);  // Bytes written, 0 = none
+    virtual bool restoreSnapshot(const uint8_t *data, uint16_t length);
+    virtual void onTrim() {}          // Snapshot stored: drop what can be rebuilt
+
+    // Event handling (true if the event changed what render() draws)
+    virtual bool onEvent(const Event &event) = 0;
 
-    // Game loop
-    virtual void update() = 0;        // Update game logic
+    // Game loop. The kernel only calls render() after launch/resume or
+    // when onEvent() or update() returned true.
+    virtual bool update() = 0;        // Update game logic; true if the frame changed
     virtual void render() = 0;        // Render to display
 
     // App metadata
@@ -42,7 +48,7 @@ public:
     void setState(AppState new_state) { state = new_state; }
 
     // Utility
-    virtual bool handleBackButton() { return false; }  // True if handled
+    virtual bool handleBackButton();  // True if handled; default returns home
 
 protected:
     AppState state = APP_STATE_INACTIVE;
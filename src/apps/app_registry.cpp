@@ -0,0 +1,26 @@
+#include "app_registry.h"
+
+// ============================================================================
+// ionOS v1.0 - APP INSTANCES
+// One static instance per enabled app; no heap, no registration at boot.
+// ============================================================================
+
+LauncherApp launcher_app;
+ClockApp clock_app;
+
+#if FEATURE_MUSIC_PLAYER
+MusicApp music_app;
+#endif
+
+#if FEATURE_TERMINAL
+TerminalApp terminal_app;
+#endif
+
+#if FEATURE_SETTINGS
+SettingsApp settings_app;
+#endif
+
+#if FEATURE_GAMES
+SnakeGame snake_game;
+TRexGame trex_game;
+#endif
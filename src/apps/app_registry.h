@@ -0,0 +1,114 @@
+#ifndef IONOS_APP_REGISTRY_H
+#define IONOS_APP_REGISTRY_H
+
+#include <stdint.h>
+#include "app_base.h"
+#include "launcher_app.h"
+#include "clock_app.h"
+#include "../config/system_config.h"
+#if FEATURE_MUSIC_PLAYER
+#include "music_app.h"
+#endif
+#if FEATURE_TERMINAL
+#include "terminal_app.h"
+#endif
+#if FEATURE_SETTINGS
+#include "settings_app.h"
+#endif
+#if FEATURE_GAMES
+#include "games/snake_game.h"
+#include "games/trex_game.h"
+#endif
+
+// ============================================================================
+// ionOS v1.0 - APP REGISTRY
+// Compile-time app table generated from the FEATURE_* flags. Every app is a
+// statically allocated instance (app_registry.cpp); a disabled feature drops
+// its row, nothing references the app any more and --gc-sections strips it.
+//
+// Adding an app: an AppId, an instance in app_registry.cpp and a row in
+// APP_TABLE, all under the same feature flag. AppId is the kernel app slot.
+// ============================================================================
+
+enum AppId : uint8_t {
+    APP_ID_LAUNCHER = HOME_APP_ID,
+    APP_ID_CLOCK,
+#if FEATURE_MUSIC_PLAYER
+    APP_ID_MUSIC,
+#endif
+#if FEATURE_TERMINAL
+    APP_ID_TERMINAL,
+#endif
+#if FEATURE_SETTINGS
+    APP_ID_SETTINGS,
+#endif
+#if FEATURE_GAMES
+    APP_ID_SNAKE,
+    APP_ID_TREX,
+#endif
+    APP_ID_COUNT
+};
+
+// Static app instances (app_registry.cpp)
+extern LauncherApp launcher_app;
+extern ClockApp clock_app;
+#if FEATURE_MUSIC_PLAYER
+extern MusicApp music_app;
+#endif
+#if FEATURE_TERMINAL
+extern TerminalApp terminal_app;
+#endif
+#if FEATURE_SETTINGS
+extern SettingsApp settings_app;
+#endif
+#if FEATURE_GAMES
+extern SnakeGame snake_game;
+extern TRexGame trex_game;
+#endif
+
+struct AppEntry {
+    AppId id;
+    const char *name;       // Launcher label
+    App *app;
+};
+
+// One row per AppId, in AppId order
+constexpr AppEntry APP_TABLE[] = {
+    { APP_ID_LAUNCHER, "Launcher", &launcher_app },
+    { APP_ID_CLOCK,    "Clock",    &clock_app },
+#if FEATURE_MUSIC_PLAYER
+    { APP_ID_MUSIC,    "Music",    &music_app },
+#endif
+#if FEATURE_TERMINAL
+    { APP_ID_TERMINAL, "Terminal", &terminal_app },
+#endif
+#if FEATURE_SETTINGS
+    { APP_ID_SETTINGS, "Settings", &settings_app },
+#endif
+#if FEATURE_GAMES
+    { APP_ID_SNAKE,    "Snake",    &snake_game },
+    { APP_ID_TREX,     "T-Rex",    &trex_game },
+#endif
+};
+
+constexpr uint8_t APP_COUNT = sizeof(APP_TABLE) / sizeof(APP_TABLE[0]);
+
+constexpr bool appTableInOrder(uint8_t i = 0) {
+    return i == APP_COUNT || (APP_TABLE[i].id == i && appTableInOrder(i + 1));
+}
+
+static_assert(HOME_APP_ID == 0, "The launcher must be the first app slot");
+static_assert(APP_COUNT == APP_ID_COUNT, "APP_TABLE needs one row per AppId");
+static_assert(appTableInOrder(), "APP_TABLE rows must be in AppId order");
+static_assert(APP_COUNT <= MAX_APPS, "More apps than kernel slots (MAX_APPS)");
+
+class AppRegistry {
+public:
+    static constexpr uint8_t getCount() { return APP_COUNT; }
+    static constexpr const AppEntry& get(AppId id) { return APP_TABLE[id]; }
+
+    // Launch, or resume if it is suspended
+    static bool launch(AppId id) { return Kernel::launchApp(APP_TABLE[id].app, id); }
+};
+
+#endif // IONOS_APP_REGISTRY_H
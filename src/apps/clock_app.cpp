@@ -12,7 +12,7 @@ ClockApp::ClockApp() : current_view(CLOCK_VIEW_DIGITAL), last_update_time(0) {}
 ClockApp::~ClockApp() {}
 
 void ClockApp::onLaunch() {
-    state = APP_STATE_ACTIVE;
+    state = APP_STATE_RUNNING;
     current_view = CLOCK_VIEW_DIGITAL;
     Serial.println("[CLOCK] Clock app launched");
 }
@@ -22,7 +22,20 @@ void ClockApp::onClose() {
     Serial.println("[CLOCK] Clock app closing");
 }
 
-void ClockApp::onEvent(const Event &event) {
+uint16_t ClockApp::saveSnapshot(uint8_t *buffer, uint16_t capacity) {
+    if (capacity < 2) return 0;
+    buffer[0] = SNAPSHOT_VERSION;
+    buffer[1] = (uint8_t)current_view;
+    return 2;
+}
+
+bool ClockApp::restoreSnapshot(const uint8_t *data, uint16_t length) {
+    if (length != 2 || data[0] != SNAPSHOT_VERSION || data[1] > CLOCK_VIEW_ALARM) return false;
+    current_view = (ClockView)data[1];
+    return true;
+}
+
+bool ClockApp::onEvent(const Event &event) {
     switch (event.type) {
         case EVENT_BUTTON_PRESS:
             switch (event.data1) {
@@ -30,7 +43,7 @@ void ClockApp::onEvent(const Event &event) {
                 case BTN_ID_DOWN:
                     // Cycle through clock views
                     switchView((ClockView)((current_view + 1) % 4));
-                    break;
+                    return true;
                 case BTN_ID_LEFT:
                 case BTN_ID_RIGHT:
                     // Reserved for time adjustment
@@ -43,14 +56,17 @@ void ClockApp::onEvent(const Event &event) {
         default:
             break;
     }
+    return false;
 }
 
-void ClockApp::update() {
+bool ClockApp::update() {
     uint32_t now = millis();
-    // Update at 1 Hz
+    // Redraw at 1 Hz
     if (now - last_update_time >= 1000) {
         last_update_time = now;
+        return true;
     }
+    return false;
 }
 
 void ClockApp::render() {
@@ -104,7 +120,7 @@ void ClockApp::renderAnalogClock() {
     uint8_t cy = 32;
     uint8_t radius = 20;
 
-    DisplayDriver::drawCircle(cx, cy, radius, true);
+    DisplayDriver::drawCircle(cx, cy, radius, false, true);
 
     // Draw hour markers
     for (int i = 0; i < 12; i++) {
@@ -23,12 +23,16 @@ public:
 
     void onLaunch() override;
     void onClose() override;
-    void onEvent(const Event &event) override;
-    void update() override;
+    uint16_t saveSnapshot(uint8_t *buffer, uint16_t capacity) override;
+    bool restoreSnapshot(const uint8_t *data, uint16_t length) override;
+    bool onEvent(const Event &event) override;
+    bool update() override;
     void render() override;
     const char* getName() override { return "Clock"; }
 
 private:
+    static const uint8_t SNAPSHOT_VERSION = 1;
+
     ClockView current_view;
     uint32_t last_update_time;
 
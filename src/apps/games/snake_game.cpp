@@ -1,8 +1,25 @@
 #include "snake_game.h"
-#include "../drivers/display_driver.h"
-#include "../drivers/button_driver.h"
+#include "../../drivers/display_driver.h"
+#include "../../drivers/button_driver.h"
+#include "../../drivers/sprite.h"
 #include <stdlib.h>
 
+// Sprite art, page-major (one byte per column, bit 0 = top row)
+static const uint8_t SNAKE_HEAD[] = { 0x7E, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0x7E };
+static const uint8_t SNAKE_BODY[] = { 0x7E, 0xFF, 0xE7, 0xC3, 0xC3, 0xE7, 0xFF, 0x7E };
+static const uint8_t FOOD[] = { 0x06, 0x0F, 0x0F, 0x06 };
+
+static StaticSprite<8, 8> head_sprite;
+static StaticSprite<8, 8> body_sprite;
+static StaticSprite<4, 4> food_sprite;
+
+static void buildSprites() {
+    if (food_sprite.isReady()) return;
+    head_sprite.build({ 8, 8, SNAKE_HEAD, nullptr });
+    body_sprite.build({ 8, 8, SNAKE_BODY, nullptr });
+    food_sprite.build({ 4, 4, FOOD, nullptr });
+}
+
 SnakeGame::SnakeGame() : snake_len(3), direction(1), next_direction(1), game_state(GAME_MENU), score(0), last_move_time(0) {
     initGame();
 }
@@ -10,7 +27,8 @@ SnakeGame::SnakeGame() : snake_len(3), direction(1), next_direction(1), game_sta
 SnakeGame::~SnakeGame() {}
 
 void SnakeGame::onLaunch() {
-    state = APP_STATE_ACTIVE;
+    state = APP_STATE_RUNNING;
+    buildSprites();
     initGame();
     Serial.println("[SNAKE] Game launched");
 }
@@ -20,8 +38,54 @@ void SnakeGame::onClose() {
     Serial.println("[SNAKE] Game closing");
 }
 
-void SnakeGame::onEvent(const Event &event) {
-    if (event.type != EVENT_BUTTON_PRESS) return;
+void SnakeGame::onSuspend() {
+    // Come back to a paused board rather than a crashed snake
+    if (game_state == GAME_PLAYING) game_state = GAME_PAUSED;
+}
+
+void SnakeGame::onResume() {
+    last_move_time = millis();
+}
+
+uint16_t SnakeGame::saveSnapshot(uint8_t *buffer, uint16_t capacity) {
+    uint16_t length = SNAPSHOT_HEADER + snake_len * 2;
+    if (capacity < length) return 0;
+
+    buffer[0] = SNAPSHOT_VERSION;
+    buffer[1] = snake_len;
+    buffer[2] = direction;
+    buffer[3] = next_direction;
+    buffer[4] = (uint8_t)game_state;
+    buffer[5] = score & 0xFF;
+    buffer[6] = score >> 8;
+    buffer[7] = food.x;
+    buffer[8] = food.y;
+    for (uint8_t i = 0; i < snake_len; i++) {
+        buffer[SNAPSHOT_HEADER + i * 2] = snake[i].x;
+        buffer[SNAPSHOT_HEADER + i * 2 + 1] = snake[i].y;
+    }
+    return length;
+}
+
+bool SnakeGame::restoreSnapshot(const uint8_t *data, uint16_t length) {
+    if (length < SNAPSHOT_HEADER || data[0] != SNAPSHOT_VERSION) return false;
+    if (data[1] == 0 || data[1] > MAX_SNAKE_LEN || length != SNAPSHOT_HEADER + data[1] * 2) return false;
+    if (data[4] > GAME_MENU) return false;
+
+    snake_len = data[1];
+    direction = data[2] & 3;
+    next_direction = data[3] & 3;
+    game_state = (GameState)data[4];
+    score = data[5] | (data[6] << 8);
+    food = {data[7], data[8]};
+    for (uint8_t i = 0; i < snake_len; i++) {
+        snake[i] = {data[SNAPSHOT_HEADER + i * 2], data[SNAPSHOT_HEADER + i * 2 + 1]};
+    }
+    return true;
+}
+
+bool SnakeGame::onEvent(const Event &event) {
+    if (event.type != EVENT_BUTTON_PRESS) return false;
 
     switch (event.data1) {
         case BTN_ID_UP:
@@ -44,20 +108,25 @@ void SnakeGame::onEvent(const Event &event) {
             break;
         case BTN_ID_BACK:
             handleBackButton();
-            break;
+            return false;
+        default:
+            return false;
     }
+    // A new direction shows on the next move
+    return event.data1 == BTN_ID_SELECT;
 }
 
-void SnakeGame::update() {
-    if (game_state != GAME_PLAYING) return;
+bool SnakeGame::update() {
+    if (game_state != GAME_PLAYING) return false;
 
     uint32_t now = millis();
-    if (now - last_move_time < 200) return;  // Move every 200ms
+    if (now - last_move_time < 200) return false;  // Move every 200ms
     last_move_time = now;
 
     direction = next_direction;
     moveSnake();
     checkCollision();
+    return true;
 }
 
 void SnakeGame::render() {
@@ -146,17 +215,18 @@ void SnakeGame::renderGame() {
     // Draw grid border
     DisplayDriver::drawRect(0, 12, GRID_WIDTH * cell_size, GRID_HEIGHT * cell_size, true, false);
 
-    // Draw snake
+    // Draw snake and food in one sprite pass
+    SpriteBatch::begin();
     for (int i = 0; i < snake_len; i++) {
         uint8_t x = snake[i].x * cell_size;
         uint8_t y = 12 + snake[i].y * cell_size;
-        DisplayDriver::drawRect(x, y, cell_size, cell_size, true, true);
+        SpriteBatch::add(i == 0 ? head_sprite : body_sprite, x, y);
     }
 
-    // Draw food
     uint8_t fx = food.x * cell_size;
     uint8_t fy = 12 + food.y * cell_size;
-    DisplayDriver::drawRect(fx + 2, fy + 2, cell_size - 4, cell_size - 4, true, true);
+    SpriteBatch::add(food_sprite, fx + 2, fy + 2);
+    SpriteBatch::flush();
 
     // Draw paused indicator
     if (game_state == GAME_PAUSED) {
@@ -1,7 +1,7 @@
 #ifndef IONOS_SNAKE_GAME_H
 #define IONOS_SNAKE_GAME_H
 
-#include "../apps/app_base.h"
+#include "../app_base.h"
 
 // ============================================================================
 // ionOS v1.0 - SNAKE GAME
@@ -27,8 +27,12 @@ public:
 
     void onLaunch() override;
     void onClose() override;
-    void onEvent(const Event &event) override;
-    void update() override;
+    void onSuspend() override;
+    void onResume() override;
+    uint16_t saveSnapshot(uint8_t *buffer, uint16_t capacity) override;
+    bool restoreSnapshot(const uint8_t *data, uint16_t length) override;
+    bool onEvent(const Event &event) override;
+    bool update() override;
     void render() override;
     const char* getName() override { return "Snake"; }
 
@@ -36,6 +40,8 @@ private:
     static const uint8_t GRID_WIDTH = 16;
     static const uint8_t GRID_HEIGHT = 8;
     static const uint8_t MAX_SNAKE_LEN = 64;
+    static const uint8_t SNAPSHOT_VERSION = 1;
+    static const uint8_t SNAPSHOT_HEADER = 9;
 
     Point snake[MAX_SNAKE_LEN];
     uint8_t snake_len;
@@ -1,15 +1,39 @@
 #include "trex_game.h"
-#include "../drivers/display_driver.h"
-#include "../drivers/button_driver.h"
+#include "../../drivers/display_driver.h"
+#include "../../drivers/button_driver.h"
+#include "../../drivers/sprite.h"
 #include <stdlib.h>
 
+// Sprite art, page-major (one byte per column, bit 0 = top row)
+static const uint8_t DINO_RUN_A[] = { 0x18, 0x30, 0xE0, 0x30, 0x38, 0x7F, 0x1D, 0x07 };
+static const uint8_t DINO_RUN_B[] = { 0x18, 0x30, 0x60, 0x30, 0x38, 0xFF, 0x1D, 0x07 };
+static const uint8_t DINO_MASK[] = { 0x18, 0x30, 0xE0, 0x30, 0x38, 0xFF, 0x1F, 0x07 };
+static const uint8_t CACTUS[] = { 0x1C, 0x10, 0xFF, 0xFF, 0x08, 0x0E };
+static const uint8_t BIRD_UP[] = { 0x08, 0x0C, 0x0C, 0x07, 0x0E, 0x0C, 0x0C, 0x04 };
+static const uint8_t BIRD_DOWN[] = { 0x08, 0x0C, 0x0C, 0x34, 0x1C, 0x0C, 0x0C, 0x04 };
+
+static StaticSprite<8, 8> dino_sprites[2];
+static StaticSprite<6, 8> cactus_sprite;
+static StaticSprite<8, 6> bird_sprites[2];
+
+static void buildSprites() {
+    if (cactus_sprite.isReady()) return;
+    dino_sprites[0].build({ 8, 8, DINO_RUN_A, DINO_MASK });
+    dino_sprites[1].build({ 8, 8, DINO_RUN_B, DINO_MASK });
+    cactus_sprite.build({ 6, 8, CACTUS, nullptr });
+    bird_sprites[0].build({ 8, 6, BIRD_UP, nullptr });
+    bird_sprites[1].build({ 8, 6, BIRD_DOWN, nullptr });
+}
+
 TRexGame::TRexGame() : game_state(STATE_MENU), dino_y(40), dino_vy(0), jumping(false),
-                       score(0), last_update_time(0), spawn_timer(0), obstacle_count(0) {}
+                       score(0), last_update_time(0), spawn_timer(0), anim_tick(0),
+                       obstacle_count(0) {}
 
 TRexGame::~TRexGame() {}
 
 void TRexGame::onLaunch() {
-    state = APP_STATE_ACTIVE;
+    state = APP_STATE_RUNNING;
+    buildSprites();
     initGame();
     Serial.println("[TREX] T-Rex game launched");
 }
@@ -19,8 +43,8 @@ void TRexGame::onClose() {
     Serial.println("[TREX] T-Rex game closing");
 }
 
-void TRexGame::onEvent(const Event &event) {
-    if (event.type != EVENT_BUTTON_PRESS) return;
+bool TRexGame::onEvent(const Event &event) {
+    if (event.type != EVENT_BUTTON_PRESS) return false;
 
     switch (event.data1) {
         case BTN_ID_UP:
@@ -35,21 +59,26 @@ void TRexGame::onEvent(const Event &event) {
             break;
         case BTN_ID_BACK:
             handleBackButton();
-            break;
+            return false;
+        default:
+            return false;
     }
+    return true;
 }
 
-void TRexGame::update() {
-    if (game_state != STATE_PLAYING) return;
+bool TRexGame::update() {
+    if (game_state != STATE_PLAYING) return false;
 
     uint32_t now = millis();
-    if (now - last_update_time < 30) return;  // ~30fps
+    if (now - last_update_time < 30) return false;  // ~30fps
     last_update_time = now;
 
     updatePhysics();
     updateObstacles();
     spawnObstacle();
     checkCollisions();
+    anim_tick++;
+    return true;
 }
 
 void TRexGame::render() {
@@ -63,10 +92,12 @@ void TRexGame::render() {
             break;
         case STATE_PLAYING:
         case STATE_PAUSED:
+            SpriteBatch::begin();
             renderDino();
             for (int i = 0; i < obstacle_count; i++) {
                 renderObstacle(obstacles[i]);
             }
+            SpriteBatch::flush();
             if (game_state == STATE_PAUSED) {
                 DisplayDriver::drawString(50, 35, "PAUSED", true);
             }
@@ -88,6 +119,7 @@ void TRexGame::initGame() {
     score = 0;
     obstacle_count = 0;
     spawn_timer = 0;
+    anim_tick = 0;
     game_state = STATE_MENU;
 }
 
@@ -157,16 +189,16 @@ void TRexGame::checkCollisions() {
 }
 
 void TRexGame::renderDino() {
-    DisplayDriver::drawRect(10, dino_y, 8, 8, true, true);
+    // Legs only move on the ground
+    uint8_t frame = (dino_y == 40) ? (anim_tick >> 2) & 1 : 0;
+    SpriteBatch::add(dino_sprites[frame], 10, dino_y);
 }
 
 void TRexGame::renderObstacle(const Obstacle &obs) {
     if (obs.type == 0) {
-        // Cactus
-        DisplayDriver::drawRect(obs.x, 48, 6, 8, true, true);
+        SpriteBatch::add(cactus_sprite, obs.x, 48);
     } else {
-        // Bird
-        DisplayDriver::drawRect(obs.x, 42, 8, 6, true, true);
+        SpriteBatch::add(bird_sprites[(anim_tick >> 3) & 1], obs.x, 42);
     }
 }
 
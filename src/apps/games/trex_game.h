@@ -1,7 +1,7 @@
 #ifndef IONOS_TREX_GAME_H
 #define IONOS_TREX_GAME_H
 
-#include "../apps/app_base.h"
+#include "../app_base.h"
 
 // ============================================================================
 // ionOS v1.0 - T-REX RUNNER GAME
@@ -15,8 +15,8 @@ public:
 
     void onLaunch() override;
     void onClose() override;
-    void onEvent(const Event &event) override;
-    void update() override;
+    bool onEvent(const Event &event) override;
+    bool update() override;
     void render() override;
     const char* getName() override { return "T-Rex"; }
 
@@ -40,6 +40,7 @@ private:
     uint16_t score;
     uint32_t last_update_time;
     uint32_t spawn_timer;
+    uint8_t anim_tick;    // Physics steps, drives sprite animation
 
     static const uint8_t MAX_OBSTACLES = 4;
     Obstacle obstacles[MAX_OBSTACLES];
@@ -1,25 +1,28 @@
 #include "launcher_app.h"
+#include "app_registry.h"
 #include "../drivers/display_driver.h"
 #include "../drivers/button_driver.h"
+#include "../core/kernel.h"
 
 // ============================================================================
 // ionOS v1.0 - LAUNCHER APP IMPLEMENTATION
 // ============================================================================
 
-LauncherApp::LauncherApp() : app_count(0), selected_index(0), last_input_time(0) {
-    for (int i = 0; i < MAX_APPS; i++) {
-        apps[i].name = nullptr;
-        apps[i].icon = nullptr;
-        apps[i].app_instance = nullptr;
-    }
+// Menu item i is registry row i + 1 (row 0 is the launcher itself)
+static constexpr uint8_t MENU_COUNT = APP_COUNT - 1;
+
+static constexpr const AppEntry& menuEntry(uint8_t index) {
+    return APP_TABLE[index + 1];
 }
 
+LauncherApp::LauncherApp() : selected_index(0), last_input_time(0) {}
+
 LauncherApp::~LauncherApp() {
     // Cleanup
 }
 
 void LauncherApp::onLaunch() {
-    state = APP_STATE_ACTIVE;
+    state = APP_STATE_RUNNING;
     selected_index = 0;
     Serial.println("[LAUNCHER] App launched");
 }
@@ -29,24 +32,24 @@ void LauncherApp::onClose() {
     Serial.println("[LAUNCHER] App closing");
 }
 
-void LauncherApp::onEvent(const Event &event) {
+bool LauncherApp::onEvent(const Event &event) {
     uint32_t now = millis();
 
-    // Debounce rapid inputs
-    if (now - last_input_time < 200) return;
-    last_input_time = now;
-
     switch (event.type) {
         case EVENT_BUTTON_PRESS:
+            // Debounce rapid inputs (buttons only: app switch events must not eat a press)
+            if (now - last_input_time < 200) return false;
+            last_input_time = now;
+
             switch (event.data1) {
                 case BTN_ID_UP:
                 case BTN_ID_LEFT:
                     moveSelection(-1);
-                    break;
+                    return true;
                 case BTN_ID_DOWN:
                 case BTN_ID_RIGHT:
                     moveSelection(1);
-                    break;
+                    return true;
                 case BTN_ID_SELECT:
                     launchSelectedApp();
                     break;
@@ -58,10 +61,12 @@ void LauncherApp::onEvent(const Event &event) {
         default:
             break;
     }
+    return false;
 }
 
-void LauncherApp::update() {
-    // Update selected app animation or state
+bool LauncherApp::update() {
+    // Nothing animates; the selection only moves on input
+    return false;
 }
 
 void LauncherApp::render() {
@@ -81,48 +86,24 @@ void LauncherApp::render() {
     DisplayDriver::drawString(2, 56, "Select: OK  Back: MENU", false);
 }
 
-void LauncherApp::registerApp(const char *name, const char *icon, App *app) {
-    if (app_count >= MAX_APPS) {
-        Serial.println("[LAUNCHER] App list full");
-        return;
-    }
-
-    apps[app_count].name = name;
-    apps[app_count].icon = icon;
-    apps[app_count].app_instance = app;
-    app_count++;
-
-    Serial.printf("[LAUNCHER] Registered app: %s\n", name);
-}
-
-void LauncherApp::unregisterApp(uint8_t index) {
-    if (index >= app_count) return;
-
-    // Shift array down
-    for (int i = index; i < app_count - 1; i++) {
-        apps[i] = apps[i + 1];
-    }
-    app_count--;
-}
-
 uint8_t LauncherApp::getAppCount() {
-    return app_count;
+    return MENU_COUNT;
 }
 
 void LauncherApp::renderAppList() {
     const uint8_t items_per_screen = 4;
     uint8_t start_idx = (selected_index / items_per_screen) * items_per_screen;
 
-    for (int i = 0; i < items_per_screen && start_idx + i < app_count; i++) {
+    for (int i = 0; i < items_per_screen && start_idx + i < MENU_COUNT; i++) {
         uint8_t app_idx = start_idx + i;
         uint8_t y = 15 + (i * 10);
 
         // Highlight selected item
         if (app_idx == selected_index) {
             DisplayDriver::drawRect(0, y - 2, 128, 10, false, true);
-            DisplayDriver::drawString(4, y, apps[app_idx].name, false);  // Inverted
+            DisplayDriver::drawString(4, y, menuEntry(app_idx).name, false);  // Inverted
         } else {
-            DisplayDriver::drawString(4, y, apps[app_idx].name, true);
+            DisplayDriver::drawString(4, y, menuEntry(app_idx).name, true);
         }
     }
 }
@@ -132,8 +113,8 @@ void LauncherApp::renderAppGrid() {
 }
 
 void LauncherApp::renderSelectedApp() {
-    if (selected_index < app_count) {
-        Serial.printf("[LAUNCHER] Selected: %s\n", apps[selected_index].name);
+    if (selected_index < MENU_COUNT) {
+        Serial.printf("[LAUNCHER] Selected: %s\n", menuEntry(selected_index).name);
     }
 }
 
@@ -141,24 +122,21 @@ void LauncherApp::moveSelection(int8_t direction) {
     int8_t new_index = selected_index + direction;
 
     if (new_index < 0) {
-        new_index = app_count - 1;  // Wrap to end
-    } else if (new_index >= app_count) {
+        new_index = MENU_COUNT - 1;  // Wrap to end
+    } else if (new_index >= MENU_COUNT) {
         new_index = 0;  // Wrap to start
     }
 
     selected_index = new_index;
-    Serial.printf("[LAUNCHER] Selection moved to: %s\n", apps[selected_index].name);
+    Serial.printf("[LAUNCHER] Selection moved to: %s\n", menuEntry(selected_index).name);
 }
 
 void LauncherApp::launchSelectedApp() {
-    if (selected_index >= app_count) return;
-
-    App *selected_app = apps[selected_index].app_instance;
-    if (selected_app == nullptr) return;
+    if (selected_index >= MENU_COUNT) return;
 
-    Serial.printf("[LAUNCHER] Launching app: %s\n", apps[selected_index].name);
+    const AppEntry &entry = menuEntry(selected_index);
+    Serial.printf("[LAUNCHER] Launching app: %s\n", entry.name);
 
-    // Launch the app (kernel will handle switching)
-    selected_app->onLaunch();
-    selected_app->setState(APP_STATE_ACTIVE);
+    // The kernel suspends the launcher and resumes the app if it already ran
+    AppRegistry::launch(entry.id);
 }
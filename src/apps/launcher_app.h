@@ -2,19 +2,12 @@
 #define IONOS_LAUNCHER_APP_H
 
 #include "../apps/app_base.h"
-#include <vector>
 
 // ============================================================================
 // ionOS v1.0 - LAUNCHER APP
-// Main menu - displays and launches other apps
+// Main menu - lists every other app in the registry (app_registry.h)
 // ============================================================================
 
-struct AppMenuItem {
-    const char *name;
-    const char *icon;
-    App *app_instance;
-};
-
 class LauncherApp : public App {
 public:
     LauncherApp();
@@ -22,20 +15,15 @@ public:
 
     void onLaunch() override;
     void onClose() override;
-    void onEvent(const Event &event) override;
-    void update() override;
+    bool onEvent(const Event &event) override;
+    bool update() override;
     void render() override;
     const char* getName() override { return "Launcher"; }
 
-    // App registration
-    void registerApp(const char *name, const char *icon, App *app);
-    void unregisterApp(uint8_t index);
+    // Menu entries (every registered app but the launcher)
     uint8_t getAppCount();
 
 private:
-    static const uint8_t MAX_APPS = 8;
-    AppMenuItem apps[MAX_APPS];
-    uint8_t app_count;
     int8_t selected_index;
     uint32_t last_input_time;
 
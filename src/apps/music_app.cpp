@@ -15,12 +15,12 @@ MusicApp::MusicApp() :
 MusicApp::~MusicApp() {}
 
 void MusicApp::onLaunch() {
-    state = APP_STATE_ACTIVE;
+    state = APP_STATE_RUNNING;
     
     // Add example songs (replace with SD card scanning later)
-    addSong("/music/song1.wav", "Song One", 180000);
-    addSong("/music/song2.wav", "Song Two", 200000);
-    addSong("/music/song3.wav", "Song Three", 220000);
+    addSong("/sd/music/song1.wav", "Song One", 180000);
+    addSong("/sd/music/song2.wav", "Song Two", 200000);
+    addSong("/sd/music/song3.wav", "Song Three", 220000);
     
     if (song_count > 0) {
         current_song_index = 0;
@@ -35,8 +35,38 @@ void MusicApp::onClose() {
     Serial.println("[MUSIC] Music app closing");
 }
 
-void MusicApp::onEvent(const Event &event) {
-    if (event.type != EVENT_BUTTON_PRESS) return;
+uint16_t MusicApp::saveSnapshot(uint8_t *buffer, uint16_t capacity) {
+    if (capacity < sizeof(Snapshot)) return 0;
+
+    Snapshot snap = {
+        .version = SNAPSHOT_VERSION,
+        .song_index = current_song_index,
+        .playing = (uint8_t)(is_playing ? 1 : 0),
+        .song_count = song_count,
+        .elapsed_ms = elapsed_time
+    };
+    memcpy(buffer, &snap, sizeof(snap));
+    return sizeof(snap);
+}
+
+bool MusicApp::restoreSnapshot(const uint8_t *data, uint16_t length) {
+    Snapshot snap;
+    if (length != sizeof(snap)) return false;
+    memcpy(&snap, data, sizeof(snap));
+
+    // Playlist changed underneath it: start over
+    if (snap.version != SNAPSHOT_VERSION || snap.song_count != song_count || snap.song_index >= (int8_t)song_count) {
+        return false;
+    }
+
+    current_song_index = snap.song_index;
+    is_playing = snap.playing != 0;
+    elapsed_time = snap.elapsed_ms;
+    return true;
+}
+
+bool MusicApp::onEvent(const Event &event) {
+    if (event.type != EVENT_BUTTON_PRESS) return false;
 
     switch (event.data1) {
         case BTN_ID_UP:
@@ -79,15 +109,17 @@ void MusicApp::onEvent(const Event &event) {
             
         case BTN_ID_BACK:
             handleBackButton();
-            break;
+            return false;
     }
+    return true;
 }
 
-void MusicApp::update() {
+bool MusicApp::update() {
     if (is_playing) {
         elapsed_time += 50;  // Update every ~50ms
         // In real implementation, query actual playback position from AudioService
     }
+    return is_playing;      // The elapsed time is on screen
 }
 
 void MusicApp::render() {
@@ -22,8 +22,10 @@ public:
 
     void onLaunch() override;
     void onClose() override;
-    void onEvent(const Event &event) override;
-    void update() override;
+    uint16_t saveSnapshot(uint8_t *buffer, uint16_t capacity) override;
+    bool restoreSnapshot(const uint8_t *data, uint16_t length) override;
+    bool onEvent(const Event &event) override;
+    bool update() override;
     void render() override;
     const char* getName() override { return "Music"; }
 
@@ -34,6 +36,16 @@ public:
 
 private:
     static const uint8_t MAX_SONGS = 20;
+    static const uint8_t SNAPSHOT_VERSION = 1;
+
+    struct Snapshot {
+        uint8_t version;
+        int8_t song_index;
+        uint8_t playing;
+        uint8_t song_count;     // Playlist it was taken against
+        uint32_t elapsed_ms;
+    };
+
 
     Song playlist[MAX_SONGS];
     uint8_t song_count;
@@ -1,13 +1,31 @@
 #include "settings_app.h"
 #include "../drivers/display_driver.h"
 #include "../drivers/button_driver.h"
+#include "../core/power.h"
+#include "../services/audio_service.h"
+#include "../services/settings_store.h"
+#include <stdio.h>
 
-SettingsApp::SettingsApp() : current_menu(SETTINGS_BRIGHTNESS), brightness_level(80), volume_level(70), sleep_timeout_ms(300000) {}
+// Settings store keys
+static const char *KEY_BRIGHTNESS = "brightness";
+static const char *KEY_VOLUME = "volume";
+static const char *KEY_SLEEP_TIMEOUT = "sleep_ms";
+
+static const uint8_t DEFAULT_BRIGHTNESS = 80;
+static const uint8_t DEFAULT_VOLUME = 70;
+static const uint8_t BRIGHTNESS_STEP = 10;
+static const uint8_t BRIGHTNESS_MIN = 10;
+static const uint8_t VOLUME_STEP = 10;
+static const uint32_t SLEEP_TIMEOUTS_MS[] = { 30000, 60000, 120000, 300000, 600000 };
+static const uint8_t SLEEP_TIMEOUT_COUNT = sizeof(SLEEP_TIMEOUTS_MS) / sizeof(SLEEP_TIMEOUTS_MS[0]);
+
+SettingsApp::SettingsApp() : current_menu(SETTINGS_BRIGHTNESS), brightness_level(DEFAULT_BRIGHTNESS), volume_level(DEFAULT_VOLUME), sleep_timeout_ms(SLEEP_TIMEOUT_MS) {}
 
 SettingsApp::~SettingsApp() {}
 
 void SettingsApp::onLaunch() {
-    state = APP_STATE_ACTIVE;
+    state = APP_STATE_RUNNING;
+    loadSettings();
     Serial.println("[SETTINGS] Settings app launched");
 }
 
@@ -16,29 +34,35 @@ void SettingsApp::onClose() {
     Serial.println("[SETTINGS] Settings app closing");
 }
 
-void SettingsApp::onEvent(const Event &event) {
-    if (event.type != EVENT_BUTTON_PRESS) return;
+bool SettingsApp::onEvent(const Event &event) {
+    if (event.type != EVENT_BUTTON_PRESS) return false;
 
     switch (event.data1) {
         case BTN_ID_UP:
-        case BTN_ID_LEFT:
             moveMenuSelection(-1);
             break;
         case BTN_ID_DOWN:
-        case BTN_ID_RIGHT:
             moveMenuSelection(1);
             break;
+        case BTN_ID_LEFT:
+            if (!adjustSetting(-1)) moveMenuSelection(-1);
+            break;
+        case BTN_ID_RIGHT:
+            if (!adjustSetting(1)) moveMenuSelection(1);
+            break;
         case BTN_ID_SELECT:
             Serial.printf("[SETTINGS] Selected menu item: %d\n", current_menu);
-            break;
+            return false;
         case BTN_ID_BACK:
             handleBackButton();
-            break;
+            return false;
     }
+    return true;
 }
 
-void SettingsApp::update() {
-    // Update logic
+bool SettingsApp::update() {
+    // Nothing changes between inputs
+    return false;
 }
 
 void SettingsApp::render() {
@@ -51,13 +75,21 @@ void SettingsApp::render() {
 
 void SettingsApp::renderMainMenu() {
     const char *menu_items[] = { "Brightness", "Volume", "Time", "Date", "Sleep", "Language", "About" };
+    char value[12];
     for (int i = 0; i < 7; i++) {
         uint8_t y = 15 + (i * 8);
-        if (i == current_menu) {
+        bool selected = i == current_menu;
+        if (selected) {
             DisplayDriver::drawRect(0, y - 2, 128, 8, false, true);
-            DisplayDriver::drawString(4, y, menu_items[i], false);
-        } else {
-            DisplayDriver::drawString(4, y, menu_items[i], true);
+        }
+        DisplayDriver::drawString(4, y, menu_items[i], !selected);
+
+        value[0] = '\0';
+        if (i == SETTINGS_BRIGHTNESS) snprintf(value, sizeof(value), "%u%%", brightness_level);
+        else if (i == SETTINGS_VOLUME) snprintf(value, sizeof(value), "%u%%", volume_level);
+        else if (i == SETTINGS_SLEEP_TIMEOUT) snprintf(value, sizeof(value), "%lus", (unsigned long)(sleep_timeout_ms / 1000));
+        if (value[0] != '\0') {
+            DisplayDriver::drawString(124 - DisplayDriver::getStringWidth(value), y, value, !selected);
         }
     }
 }
@@ -75,3 +107,57 @@ void SettingsApp::moveMenuSelection(int8_t direction) {
     else if (new_menu > 6) new_menu = 0;
     current_menu = (SettingsMenu)new_menu;
 }
+
+bool SettingsApp::adjustSetting(int8_t direction) {
+    switch (current_menu) {
+        case SETTINGS_BRIGHTNESS: {
+            int16_t level = brightness_level + direction * BRIGHTNESS_STEP;
+            brightness_level = level < BRIGHTNESS_MIN ? BRIGHTNESS_MIN : level > 100 ? 100 : level;
+            SettingsStore::setU32(KEY_BRIGHTNESS, brightness_level);
+            break;
+        }
+        case SETTINGS_VOLUME: {
+            int16_t level = volume_level + direction * VOLUME_STEP;
+            volume_level = level < 0 ? 0 : level > AUDIO_MAX_VOLUME ? AUDIO_MAX_VOLUME : level;
+            SettingsStore::setU32(KEY_VOLUME, volume_level);
+            break;
+        }
+        case SETTINGS_SLEEP_TIMEOUT: {
+            // First preset at or above the current value, then one step
+            uint8_t step = 0;
+            while (step < SLEEP_TIMEOUT_COUNT - 1 && SLEEP_TIMEOUTS_MS[step] < sleep_timeout_ms) step++;
+            if (direction < 0) {
+                if (step > 0) step--;
+            } else if (SLEEP_TIMEOUTS_MS[step] == sleep_timeout_ms && step < SLEEP_TIMEOUT_COUNT - 1) {
+                step++;
+            }
+            sleep_timeout_ms = SLEEP_TIMEOUTS_MS[step];
+            SettingsStore::setU32(KEY_SLEEP_TIMEOUT, sleep_timeout_ms);
+            break;
+        }
+        default:
+            return false;
+    }
+
+    // Applied now; the store writes it once the changes stop coming
+    applySettings(brightness_level, volume_level, sleep_timeout_ms);
+    return true;
+}
+
+void SettingsApp::loadSettings() {
+    brightness_level = SettingsStore::getU32(KEY_BRIGHTNESS, brightness_level);
+    volume_level = SettingsStore::getU32(KEY_VOLUME, volume_level);
+    sleep_timeout_ms = SettingsStore::getU32(KEY_SLEEP_TIMEOUT, sleep_timeout_ms);
+}
+
+void SettingsApp::applySavedSettings() {
+    applySettings(SettingsStore::getU32(KEY_BRIGHTNESS, DEFAULT_BRIGHTNESS),
+                  SettingsStore::getU32(KEY_VOLUME, DEFAULT_VOLUME),
+                  SettingsStore::getU32(KEY_SLEEP_TIMEOUT, SLEEP_TIMEOUT_MS));
+}
+
+void SettingsApp::applySettings(uint8_t brightness, uint8_t volume, uint32_t sleep_timeout) {
+    DisplayDriver::setContrast(brightness * 255 / 100);
+    AudioService::setVolume(volume * 255 / AUDIO_MAX_VOLUME);
+    PowerManager::setSleepTimeout(sleep_timeout);
+}
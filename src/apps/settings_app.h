@@ -6,6 +6,10 @@
 // ============================================================================
 // ionOS v1.0 - SETTINGS APP
 // System configuration (brightness, volume, time, etc.)
+//
+// UP/DOWN pick an item, LEFT/RIGHT change brightness, volume and the sleep
+// timeout. Changes apply at once and persist through the SettingsStore,
+// which batches a burst of steps into one flash write.
 // ============================================================================
 
 enum SettingsMenu {
@@ -25,11 +29,14 @@ public:
 
     void onLaunch() override;
     void onClose() override;
-    void onEvent(const Event &event) override;
-    void update() override;
+    bool onEvent(const Event &event) override;
+    bool update() override;
     void render() override;
     const char* getName() override { return "Settings"; }
 
+    // Apply the persisted values at boot (after SettingsStore::init())
+    static void applySavedSettings();
+
 private:
     SettingsMenu current_menu;
     uint8_t brightness_level;
@@ -47,6 +54,11 @@ private:
 
     // Navigation
     void moveMenuSelection(int8_t direction);
+    bool adjustSetting(int8_t direction);      // False if the item has no value
+
+    // Persisted values
+    void loadSettings();
+    static void applySettings(uint8_t brightness, uint8_t volume, uint32_t sleep_timeout);
 };
 
 #endif // IONOS_SETTINGS_APP_H
@@ -16,7 +16,7 @@ TerminalApp::TerminalApp() :
 TerminalApp::~TerminalApp() {}
 
 void TerminalApp::onLaunch() {
-    state = APP_STATE_ACTIVE;
+    state = APP_STATE_RUNNING;
     clearBuffer();
     history_lines = 0;
     scroll_offset = 0;
@@ -30,8 +30,48 @@ void TerminalApp::onClose() {
     Serial.println("[TERMINAL] Terminal app closing");
 }
 
-void TerminalApp::onEvent(const Event &event) {
-    if (event.type != EVENT_BUTTON_PRESS) return;
+// Snapshot: version, input_pos, scroll_offset, history_lines, then the input
+// line and each history line as NUL-terminated strings
+uint16_t TerminalApp::saveSnapshot(uint8_t *buffer, uint16_t capacity) {
+    uint16_t pos = 0;
+    if (capacity < 4) return 0;
+    buffer[pos++] = SNAPSHOT_VERSION;
+    buffer[pos++] = input_pos;
+    buffer[pos++] = scroll_offset;
+    buffer[pos++] = history_lines;
+
+    for (int8_t line = -1; line < (int8_t)history_lines; line++) {
+        const char *text = (line < 0) ? input_buffer : history[line];
+        uint16_t len = strnlen(text, BUFFER_SIZE - 1) + 1;
+        if (pos + len > capacity) return 0;
+        memcpy(buffer + pos, text, len - 1);
+        buffer[pos + len - 1] = '\0';
+        pos += len;
+    }
+    return pos;
+}
+
+bool TerminalApp::restoreSnapshot(const uint8_t *data, uint16_t length) {
+    if (length < 4 || data[0] != SNAPSHOT_VERSION || data[3] > HISTORY_LINES) return false;
+
+    uint16_t pos = 4;
+    for (int8_t line = -1; line < (int8_t)data[3]; line++) {
+        char *text = (line < 0) ? input_buffer : history[line];
+        uint16_t len = strnlen((const char*)data + pos, length - pos);
+        if (len >= BUFFER_SIZE || pos + len >= length) return false;
+        memcpy(text, data + pos, len);
+        text[len] = '\0';
+        pos += len + 1;
+    }
+
+    input_pos = data[1] < BUFFER_SIZE ? data[1] : 0;
+    scroll_offset = data[2];
+    history_lines = data[3];
+    return true;
+}
+
+bool TerminalApp::onEvent(const Event &event) {
+    if (event.type != EVENT_BUTTON_PRESS) return false;
 
     switch (event.data1) {
         case BTN_ID_UP:
@@ -46,10 +86,10 @@ void TerminalApp::onEvent(const Event &event) {
             break;
         case BTN_ID_LEFT:
             // Reserved for cursor in text input
-            break;
+            return false;
         case BTN_ID_RIGHT:
             // Reserved for cursor in text input
-            break;
+            return false;
         case BTN_ID_SELECT:
             // Open on-screen keyboard for input
             if (Keyboard::editString(input_buffer, BUFFER_SIZE)) {
@@ -61,12 +101,14 @@ void TerminalApp::onEvent(const Event &event) {
             break;
         case BTN_ID_BACK:
             handleBackButton();
-            break;
+            return false;
     }
+    return true;
 }
 
-void TerminalApp::update() {
+bool TerminalApp::update() {
     // Nothing time-based yet
+    return false;
 }
 
 void TerminalApp::render() {
@@ -15,14 +15,17 @@ public:
 
     void onLaunch() override;
     void onClose() override;
-    void onEvent(const Event &event) override;
-    void update() override;
+    uint16_t saveSnapshot(uint8_t *buffer, uint16_t capacity) override;
+    bool restoreSnapshot(const uint8_t *data, uint16_t length) override;
+    bool onEvent(const Event &event) override;
+    bool update() override;
     void render() override;
     const char* getName() override { return "Terminal"; }
 
 private:
     static const uint8_t BUFFER_SIZE = 32;
     static const uint8_t HISTORY_LINES = 8;
+    static const uint8_t SNAPSHOT_VERSION = 1;
 
     char input_buffer[BUFFER_SIZE];
     uint8_t input_pos;
@@ -0,0 +1,137 @@
+#include "boot_timeline.h"
+#include <Arduino.h>
+
+// ============================================================================
+// ionOS v1.0 - BOOT TIMELINE IMPLEMENTATION
+// ============================================================================
+
+// Static member initialization
+BootStage BootTimeline::stages[BOOT_TIMELINE_STAGES];
+uint8_t BootTimeline::stage_count = 0;
+uint32_t BootTimeline::setup_us = 0;
+uint32_t BootTimeline::first_frame_us = 0;
+uint32_t BootTimeline::interactive_us = 0;
+
+// Width of the report's timeline bars (characters)
+static const uint8_t BAR_WIDTH = 32;
+
+// Metric timestamps use 0 for "not yet"
+static uint32_t stampNow() {
+    uint32_t now = micros();
+    return now != 0 ? now : 1;
+}
+
+// One report row: start and duration in ms, then the stage's slice of the boot
+static void printRow(const char *name, uint32_t start_us, uint32_t end_us, uint32_t span_us) {
+    uint32_t took_us = end_us - start_us;
+    Serial.printf("â•‘ %-9s %5lu.%lu %5lu.%lu |", name,
+        (unsigned long)(start_us / 1000), (unsigned long)(start_us / 100 % 10),
+        (unsigned long)(took_us / 1000), (unsigned long)(took_us / 100 % 10));
+
+    uint8_t from = (uint64_t)start_us * BAR_WIDTH / span_us;
+    uint8_t to = (uint64_t)end_us * BAR_WIDTH / span_us;
+    if (to == from && to < BAR_WIDTH) to++;     // Short stages still show up
+    for (uint8_t col = 0; col < BAR_WIDTH; col++) {
+        Serial.print(col >= from && col < to ? '#' : '.');
+    }
+    Serial.println("|");
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Start the timeline (micros() already counts from reset)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void BootTimeline::init() {
+    stage_count = 0;
+    first_frame_us = 0;
+    interactive_us = 0;
+    setup_us = micros();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Open a stage
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint8_t BootTimeline::begin(const char *name) {
+    if (stage_count >= BOOT_TIMELINE_STAGES) {
+        return NO_STAGE;
+    }
+
+    BootStage &stage = stages[stage_count];
+    stage.name = name;
+    stage.start_us = micros();
+    stage.end_us = 0;
+    stage.ok = false;
+    return stage_count++;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Close a stage
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void BootTimeline::end(uint8_t stage, bool ok) {
+    if (stage >= stage_count) {
+        return;
+    }
+
+    stages[stage].end_us = stampNow();
+    stages[stage].ok = ok;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Time-to-first-frame
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void BootTimeline::markFirstFrame() {
+    if (first_frame_us == 0) {
+        first_frame_us = stampNow();
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Time-to-interactive
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void BootTimeline::markInteractive() {
+    if (interactive_us != 0) {
+        return;
+    }
+    interactive_us = stampNow();
+
+#if BOOT_TIMELINE_REPORT
+    Serial.printf("[BOOT] First frame %lu.%lu ms%s, interactive %lu.%lu ms\n",
+        (unsigned long)(first_frame_us / 1000), (unsigned long)(first_frame_us / 100 % 10),
+        first_frame_us ? "" : " (not yet)",
+        (unsigned long)(interactive_us / 1000), (unsigned long)(interactive_us / 100 % 10));
+#endif
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Print the timeline: one bar per stage, scaled to the whole boot
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void BootTimeline::printReport() {
+    // Scale to the last thing that happened
+    uint32_t span = interactive_us;
+    for (uint8_t i = 0; i < stage_count; i++) {
+        if (stages[i].end_us > span) span = stages[i].end_us;
+    }
+    if (span == 0) span = 1;
+
+    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
+    Serial.println("â•‘  BOOT TIMELINE (ms)               â•‘");
+    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
+    Serial.printf("â•‘ %-9s %7s %7s  0 ms %*s%lu ms\n", "stage", "start", "took",
+        BAR_WIDTH - 8, "", (unsigned long)(span / 1000));
+    printRow("setup", 0, setup_us, span);
+
+    for (uint8_t i = 0; i < stage_count; i++) {
+        const BootStage &stage = stages[i];
+        printRow(stage.name, stage.start_us, stage.end_us ? stage.end_us : span, span);
+        if (!stage.ok) {
+            Serial.println(stage.end_us ? "â•‘   ^ failed" : "â•‘   ^ still running");
+        }
+    }
+
+    Serial.printf("â•‘ Time to first frame: %lu.%lu ms%s\n",
+        (unsigned long)(first_frame_us / 1000), (unsigned long)(first_frame_us / 100 % 10),
+        first_frame_us ? "" : " (not yet)");
+    Serial.printf("â•‘ Time to interactive: %lu.%lu ms%s\n",
+        (unsigned long)(interactive_us / 1000), (unsigned long)(interactive_us / 100 % 10),
+        interactive_us ? "" : " (not yet)");
+    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+}
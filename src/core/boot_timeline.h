@@ -0,0 +1,55 @@
+#ifndef IONOS_BOOT_TIMELINE_H
+#define IONOS_BOOT_TIMELINE_H
+
+#include <stdint.h>
+#include "../config/system_config.h"
+
+// ============================================================================
+// ionOS v1.0 - BOOT TIMELINE
+// Timestamps each boot stage (micros() since reset) so the boot report shows
+// where wake-up time goes. Stages may overlap: a stage that is started
+// before another one and finished after it ran concurrently with it.
+// Two metrics are tracked on top of the stages:
+//   time-to-first-frame (TTFF) - the first frame (splash) reached the panel
+//   time-to-interactive (TTI)  - the first kernel tick completed, so input
+//                                is polled and the home app has rendered
+// Boot runs on one thread; call from setup() and the kernel loop only.
+// ============================================================================
+
+struct BootStage {
+    const char *name;
+    uint32_t start_us;
+    uint32_t end_us;        // 0 while the stage is still running
+    bool ok;
+};
+
+class BootTimeline {
+public:
+    static const uint8_t NO_STAGE = 0xFF;
+
+    static void init();                         // First thing in setup()
+
+    // Stages (begin() returns NO_STAGE once the table is full)
+    static uint8_t begin(const char *name);
+    static void end(uint8_t stage, bool ok = true);
+
+    // Metrics (only the first call counts)
+    static void markFirstFrame();
+    static void markInteractive();
+    static bool isInteractive() { return interactive_us != 0; }
+    static uint32_t getSetupTime() { return setup_us; }             // Reset -> setup()
+    static uint32_t getFirstFrameTime() { return first_frame_us; }  // 0 = not yet
+    static uint32_t getInteractiveTime() { return interactive_us; } // 0 = not yet
+
+    // Debug
+    static void printReport();
+
+private:
+    static BootStage stages[BOOT_TIMELINE_STAGES];
+    static uint8_t stage_count;
+    static uint32_t setup_us;
+    static uint32_t first_frame_us;
+    static uint32_t interactive_us;
+};
+
+#endif // IONOS_BOOT_TIMELINE_H
@@ -0,0 +1,104 @@
+#ifndef IONOS_BYTE_RING_H
+#define IONOS_BYTE_RING_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// ============================================================================
+// ionOS v1.0 - BYTE RING BUFFER
+// Lock-free single-producer / single-consumer byte stream over storage the
+// caller provides (power-of-two size). Besides copying read()/write(),
+// either side can work in place on the contiguous region up to the wrap:
+// the producer fills writable() and commit()s, the consumer drains
+// readable() and consume()s, so file data can land straight in the ring.
+// ============================================================================
+
+class ByteRing {
+public:
+    ByteRing() : storage(nullptr), mask(0), head(0), tail(0) {}
+
+    // False if size is not a power of two
+    bool init(uint8_t *buffer, uint32_t size) {
+        if (buffer == nullptr || size < 2 || (size & (size - 1)) != 0) {
+            return false;
+        }
+        storage = buffer;
+        mask = size - 1;
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Producer side
+    uint32_t writable(uint8_t *&region) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t space = capacity() - (h - tail.load(std::memory_order_acquire));
+        uint32_t to_wrap = capacity() - (h & mask);
+        region = storage + (h & mask);
+        return space < to_wrap ? space : to_wrap;
+    }
+
+    void commit(uint32_t count) {
+        head.store(head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    uint32_t write(const uint8_t *data, uint32_t count) {
+        uint32_t written = 0;
+        uint8_t *region;
+        uint32_t span;
+        while (written < count && (span = writable(region)) > 0) {
+            if (span > count - written) span = count - written;
+            memcpy(region, data + written, span);
+            commit(span);
+            written += span;
+        }
+        return written;
+    }
+
+    // Consumer side
+    uint32_t readable(const uint8_t *&region) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t used = head.load(std::memory_order_acquire) - t;
+        uint32_t to_wrap = capacity() - (t & mask);
+        region = storage + (t & mask);
+        return used < to_wrap ? used : to_wrap;
+    }
+
+    void consume(uint32_t count) {
+        tail.store(tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    uint32_t read(uint8_t *data, uint32_t count) {
+        uint32_t copied = 0;
+        const uint8_t *region;
+        uint32_t span;
+        while (copied < count && (span = readable(region)) > 0) {
+            if (span > count - copied) span = count - copied;
+            memcpy(data + copied, region, span);
+            consume(span);
+            copied += span;
+        }
+        return copied;
+    }
+
+    // Consumer side: drop everything currently buffered
+    void clear() {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    uint32_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    uint32_t space() const { return capacity() - size(); }
+    uint32_t capacity() const { return storage ? mask + 1 : 0; }
+    bool isEmpty() const { return size() == 0; }
+
+private:
+    uint8_t *storage;
+    uint32_t mask;
+    std::atomic<uint32_t> head;     // Written by the producer only
+    std::atomic<uint32_t> tail;     // Written by the consumer only
+};
+
+#endif // IONOS_BYTE_RING_H
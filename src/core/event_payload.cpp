@@ -0,0 +1,139 @@
+#include "event_payload.h"
+#include <Arduino.h>
+
+// ============================================================================
+// ionOS v1.0 - EVENT PAYLOAD POOL IMPLEMENTATION
+// Allocation claims a free bit of one bitmap word with CAS, so producers on
+// either core and ISRs never take a lock or touch the heap.
+// ============================================================================
+
+// Static member initialization
+EventPayload EventPayloads::blocks[EVENT_PAYLOAD_BLOCKS];
+std::atomic<uint32_t> EventPayloads::used_mask(0);
+std::atomic<uint32_t> EventPayloads::alloc_failures(0);
+std::atomic<uint8_t> EventPayloads::peak_used(0);
+
+static const uint32_t ALL_BLOCKS = (EVENT_PAYLOAD_BLOCKS == 32) ? 0xFFFFFFFF : ((1u << EVENT_PAYLOAD_BLOCKS) - 1);
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Initialize the pool (every block free; not safe against concurrent use)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void EventPayloads::init() {
+    for (uint8_t i = 0; i < EVENT_PAYLOAD_BLOCKS; i++) {
+        blocks[i].refs.store(0, std::memory_order_relaxed);
+        blocks[i].index = i;
+        blocks[i].length = 0;
+    }
+    used_mask.store(0, std::memory_order_release);
+    alloc_failures.store(0, std::memory_order_relaxed);
+    peak_used.store(0, std::memory_order_relaxed);
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Allocate a block holding one reference
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+EventPayload* IRAM_ATTR EventPayloads::alloc(uint16_t length) {
+    if (length > EVENT_PAYLOAD_SIZE) {
+        alloc_failures.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    uint32_t used = used_mask.load(std::memory_order_relaxed);
+    for (;;) {
+        uint32_t free_blocks = ~used & ALL_BLOCKS;
+        if (free_blocks == 0) {
+            alloc_failures.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        // Lowest free block
+        uint32_t bit = free_blocks & (~free_blocks + 1);
+        if (used_mask.compare_exchange_weak(used, used | bit,
+                                            std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+            EventPayload *payload = &blocks[__builtin_ctz(bit)];
+            payload->refs.store(1, std::memory_order_relaxed);
+            payload->length = length;
+
+            // Statistic only: a racing update may lose a new peak
+            uint8_t in_use = __builtin_popcount(used | bit);
+            if (in_use > peak_used.load(std::memory_order_relaxed)) {
+                peak_used.store(in_use, std::memory_order_relaxed);
+            }
+            return payload;
+        }
+        // Lost the race; used now holds the current mask
+    }
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Add a reference (a handler keeping the data past its callback)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void IRAM_ATTR EventPayloads::retain(EventPayload *payload) {
+    if (payload == nullptr) return;
+    payload->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Drop a reference; the last one returns the block to the pool
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void IRAM_ATTR EventPayloads::release(EventPayload *payload) {
+    if (payload == nullptr) return;
+    if (payload->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        used_mask.fetch_and(~(1u << payload->index), std::memory_order_release);
+    }
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get the pool block an event carries in data3 (nullptr if none)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+EventPayload* IRAM_ATTR EventPayloads::fromEvent(const Event &event) {
+    // data3 may hold any pointer (an App, a plain integer); only blocks
+    // inside the pool are payloads
+    uintptr_t addr = (uintptr_t)event.data3;
+    uintptr_t base = (uintptr_t)&blocks[0];
+    if (addr < base || addr >= (uintptr_t)&blocks[EVENT_PAYLOAD_BLOCKS]) {
+        return nullptr;
+    }
+    if ((addr - base) % sizeof(EventPayload) != 0) {
+        return nullptr;
+    }
+    return (EventPayload*)event.data3;
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Release the payload of an event, if it carries one
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void IRAM_ATTR EventPayloads::releaseEvent(const Event &event) {
+    release(fromEvent(event));
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get blocks currently allocated
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint8_t EventPayloads::getUsedCount() {
+    return __builtin_popcount(used_mask.load(std::memory_order_acquire));
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get the most blocks ever allocated at once
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint8_t EventPayloads::getPeakCount() {
+    return peak_used.load(std::memory_order_relaxed);
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get allocations refused because the pool was exhausted
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t EventPayloads::getFailedCount() {
+    return alloc_failures.load(std::memory_order_relaxed);
+}
+
@@ -0,0 +1,69 @@
+#ifndef IONOS_EVENT_PAYLOAD_H
+#define IONOS_EVENT_PAYLOAD_H
+
+#include <stdint.h>
+#include <atomic>
+#include "events.h"
+#include "../config/system_config.h"
+
+// ============================================================================
+// ionOS v1.0 - EVENT PAYLOAD POOL
+// Fixed-size, reference-counted blocks for event data that does not fit in
+// data1/data2. A producer allocates a block, fills it and posts it in
+// Event::data3; the queue and kernel own it from then on and release it
+// once every subscriber has seen the event. Handlers that keep the data
+// past their callback retain() it and release() it when done.
+// ============================================================================
+
+// Typed payloads
+struct ButtonPayload {
+    uint32_t press_ms;      // When the press was committed (millis)
+    uint32_t duration_ms;   // How long the button was held
+};
+
+struct EventPayload {
+    std::atomic<uint8_t> refs;
+    uint8_t index;          // Block number in the pool
+    uint16_t length;        // Bytes of data in use
+    alignas(4) uint8_t data[EVENT_PAYLOAD_SIZE];
+
+    template <typename T> T* as() {
+        static_assert(sizeof(T) <= EVENT_PAYLOAD_SIZE, "Payload type larger than a pool block");
+        return reinterpret_cast<T*>(data);
+    }
+    template <typename T> const T* as() const {
+        static_assert(sizeof(T) <= EVENT_PAYLOAD_SIZE, "Payload type larger than a pool block");
+        return reinterpret_cast<const T*>(data);
+    }
+};
+
+// Payload pool manager (all calls are lock-free and ISR-safe)
+class EventPayloads {
+public:
+    static void init();
+
+    // Block with one reference, or nullptr when the pool is exhausted
+    static EventPayload* alloc(uint16_t length = 0);
+    static void retain(EventPayload *payload);
+    static void release(EventPayload *payload);
+
+    // Event helpers (nullptr / no-op when data3 is not a pool block)
+    static EventPayload* fromEvent(const Event &event);
+    static void releaseEvent(const Event &event);
+
+    // Pool state
+    static uint8_t getUsedCount();
+    static uint8_t getPeakCount();
+    static uint32_t getFailedCount();
+    static uint8_t getCapacity() { return EVENT_PAYLOAD_BLOCKS; }
+
+private:
+    static_assert(EVENT_PAYLOAD_BLOCKS >= 1 && EVENT_PAYLOAD_BLOCKS <= 32, "Pool bitmap is one word");
+
+    static EventPayload blocks[EVENT_PAYLOAD_BLOCKS];
+    static std::atomic<uint32_t> used_mask;     // Bit i set = blocks[i] allocated
+    static std::atomic<uint32_t> alloc_failures;
+    static std::atomic<uint8_t> peak_used;
+};
+
+#endif // IONOS_EVENT_PAYLOAD_H
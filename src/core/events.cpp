@@ -1,37 +1,67 @@
 #include "events.h"
+#include "event_payload.h"
 #include <Arduino.h>
+#include "../config/system_config.h"
 
 // ============================================================================
 // ionOS v1.0 - EVENT QUEUE IMPLEMENTATION
+// Multi-level queue: one ring per EventPriority, highest non-empty level
+// found in O(1) from a bitmap.
+//
+// Each level is a bounded lock-free MpscRing: producers (tasks on either
+// core, ISRs) claim a slot with a CAS and publish it through the slot's
+// sequence number; the kernel loop is the only consumer.
+//
+// Coalesced types keep at most one event queued: the first post enqueues a
+// token, later posts merge into the type's atomic state word, and the
+// consumer swaps the merged data into the token when it dequeues it.
 // ============================================================================
 
 // Static member initialization
-Event EventQueue::event_queue[EventQueue::MAX_QUEUE_SIZE];
-uint16_t EventQueue::queue_head = 0;
-uint16_t EventQueue::queue_tail = 0;
-uint16_t EventQueue::queue_count = 0;
-uint16_t EventQueue::queue_capacity = 64;
-bool EventQueue::event_filter[256];
+MpscRing<Event, EventQueue::LEVEL_SLOTS> EventQueue::levels[EventQueue::PRIORITY_LEVELS];
+std::atomic<uint8_t> EventQueue::level_mask(0);
+uint16_t EventQueue::low_skips = 0;
+uint32_t EventQueue::low_promotions = 0;
+std::atomic<uint32_t> EventQueue::event_filter[256 / 32];
+std::atomic<uint32_t> EventQueue::coalesce_mask[256 / 32];
+CoalesceEntry EventQueue::coalesce_entries[MAX_COALESCED_TYPES];
+std::atomic<uint32_t> EventQueue::coalesced_count(0);
+
+// Set in CoalesceEntry::state while a token is queued
+static const uint32_t COALESCE_PENDING = 0x80000000;
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Initialize event queue
+// Initialize event queue (queue_size is the per-priority capacity)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool EventQueue::init(uint16_t queue_size) {
-    if (queue_size > MAX_QUEUE_SIZE) {
-        queue_size = MAX_QUEUE_SIZE;
+    // Rounded down to a power of two (not safe against concurrent posts)
+    for (int level = 0; level < PRIORITY_LEVELS; level++) {
+        levels[level].reset(queue_size);
     }
-
-    queue_capacity = queue_size;
-    queue_head = 0;
-    queue_tail = 0;
-    queue_count = 0;
+    level_mask.store(0, std::memory_order_release);
+    low_skips = 0;
+    low_promotions = 0;
 
     // Enable all events by default
-    for (int i = 0; i < 256; i++) {
-        event_filter[i] = true;
+    for (int i = 0; i < 256 / 32; i++) {
+        event_filter[i].store(0xFFFFFFFF, std::memory_order_relaxed);
+        coalesce_mask[i].store(0, std::memory_order_relaxed);
+    }
+
+    for (int i = 0; i < MAX_COALESCED_TYPES; i++) {
+        coalesce_entries[i].type = EVENT_NONE;
+        coalesce_entries[i].policy = COALESCE_NONE;
+        coalesce_entries[i].state.store(0, std::memory_order_relaxed);
     }
+    coalesced_count.store(0, std::memory_order_relaxed);
 
-    Serial.printf("[EVENT_QUEUE] Initialized with capacity %d\n", queue_capacity);
+    EventPayloads::init();
+
+    // High-rate events only ever need their latest value
+    setCoalescePolicy(EVENT_SYSTEM_TICK, COALESCE_LATEST);
+    setCoalescePolicy(EVENT_DISPLAY_UPDATE, COALESCE_LATEST);
+
+    Serial.printf("[EVENT_QUEUE] Initialized with %d levels x %d events\n", PRIORITY_LEVELS, (int)levels[0].capacity());
     return true;
 }
 
@@ -39,126 +69,381 @@ bool EventQueue::init(uint16_t queue_size) {
 // Shutdown event queue
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void EventQueue::shutdown() {
-    queue_count = 0;
-    queue_head = 0;
-    queue_tail = 0;
+    flush();
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Post an event to the queue
+// Post an event to the queue of its priority level (any task)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool EventQueue::postEvent(const Event &event) {
     // Check if event type is filtered
-    if (!event_filter[event.type]) {
+    if (!testBit(event_filter, event.type)) {
+        EventPayloads::releaseEvent(event);
         return false;  // Event filtered out
     }
 
-    // Check if queue is full
-    if (queue_count >= queue_capacity) {
-        Serial.printf("[EVENT_QUEUE] Queue full! Dropping event type %d\n", event.type);
+    // Levels fill independently, so an input storm can't crowd out
+    // critical events
+    if (!postEventFromISR(event)) {
+        Serial.printf("[EVENT_QUEUE] Queue full! Dropping event type %d (priority %d)\n", event.type, event.priority);
+        return false;
+    }
+
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Post from interrupt context (no logging, IRAM-resident)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool IRAM_ATTR EventQueue::postEventFromISR(const Event &event) {
+    // The queue owns a posted payload, delivered or not
+    if (!testBit(event_filter, event.type)) {
+        EventPayloads::releaseEvent(event);
         return false;
     }
 
-    // Add event to queue
-    event_queue[queue_tail] = event;
-    queue_tail = nextIndex(queue_tail);
-    queue_count++;
+    CoalesceEntry *entry = nullptr;
+    if (event.data3 == nullptr && testBit(coalesce_mask, event.type)) {
+        entry = findCoalesceEntry(event.type);
+        if (entry != nullptr && mergeCoalesced(*entry, event)) {
+            return true;  // Folded into the queued token
+        }
+    }
 
+    if (!push(event)) {
+        if (entry != nullptr) {
+            // No token made it into the queue: drop the merged state too
+            entry->state.store(0, std::memory_order_release);
+        }
+        EventPayloads::releaseEvent(event);
+        return false;
+    }
     return true;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Get event from queue (FIFO - removes from queue)
+// Test one bit of a 256-bit type bitmap
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool IRAM_ATTR EventQueue::testBit(const std::atomic<uint32_t> *bits, uint8_t index) {
+    return (bits[index >> 5].load(std::memory_order_relaxed) >> (index & 31)) & 1;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Find the coalescing entry of a type (nullptr if none)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+CoalesceEntry* IRAM_ATTR EventQueue::findCoalesceEntry(uint8_t type) {
+    for (int i = 0; i < MAX_COALESCED_TYPES; i++) {
+        if (coalesce_entries[i].type == type && coalesce_entries[i].policy != COALESCE_NONE) {
+            return &coalesce_entries[i];
+        }
+    }
+    return nullptr;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Merge a post into the pending state (true if a token is already queued)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool IRAM_ATTR EventQueue::mergeCoalesced(CoalesceEntry &entry, const Event &event) {
+    uint32_t old_state = entry.state.load(std::memory_order_relaxed);
+    uint32_t new_state;
+
+    do {
+        uint32_t data1 = event.data1;
+        uint32_t data2 = event.data2;
+
+        if (old_state & COALESCE_PENDING) {
+            uint32_t pending1 = old_state & 0xFF;
+            uint32_t pending2 = (old_state >> 8) & 0xFF;
+
+            if (entry.policy == COALESCE_ACCUMULATE) {
+                data1 = (pending1 + data1 > 255) ? 255 : pending1 + data1;
+                data2 = (pending2 + data2 > 255) ? 255 : pending2 + data2;
+            } else if (entry.policy == COALESCE_BITS) {
+                data1 |= pending1;
+                data2 |= pending2;
+            }
+        }
+
+        new_state = COALESCE_PENDING | (data2 << 8) | data1;
+    } while (!entry.state.compare_exchange_weak(old_state, new_state,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_relaxed));
+
+    entry.timestamp.store(event.timestamp, std::memory_order_relaxed);
+
+    if (old_state & COALESCE_PENDING) {
+        coalesced_count.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;  // Caller enqueues the token
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Fill a dequeued token with the merged data (consumer)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void EventQueue::takeCoalesced(Event &event, bool consume) {
+    if (event.data3 != nullptr || !testBit(coalesce_mask, event.type)) {
+        return;
+    }
+
+    CoalesceEntry *entry = findCoalesceEntry(event.type);
+    if (entry == nullptr) {
+        return;
+    }
+
+    // Clearing the state on take lets the next post enqueue a new token
+    uint32_t state = consume ? entry->state.exchange(0, std::memory_order_acq_rel)
+                             : entry->state.load(std::memory_order_acquire);
+    if (state & COALESCE_PENDING) {
+        event.data1 = state & 0xFF;
+        event.data2 = (state >> 8) & 0xFF;
+        event.timestamp = entry->timestamp.load(std::memory_order_relaxed);
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Claim a slot with CAS on the tail, fill it, then publish it
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool IRAM_ATTR EventQueue::push(const Event &event) {
+    uint8_t level = (event.priority < PRIORITY_LEVELS) ? event.priority : PRIORITY_NORMAL;
+    if (!levels[level].push(event)) {
+        return false;  // Level is full (counted by the ring)
+    }
+
+    // Set after publishing, so a set bit never points at an unpublished slot
+    level_mask.fetch_or((uint8_t)(1 << level), std::memory_order_release);
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Check whether the next slot of a level is published (consumer)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool EventQueue::levelReady(uint8_t level) {
+    return levels[level].ready();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Pick the level to dequeue from (-1 if empty)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+int8_t EventQueue::selectLevel() {
+    // Bounded starvation: after EVENT_LOW_MAX_WAIT dequeues that passed a
+    // waiting LOW event, serve it next (critical events still go first)
+    if (low_skips >= EVENT_LOW_MAX_WAIT && levelReady(PRIORITY_LOW) &&
+        !levelReady(PRIORITY_CRITICAL)) {
+        return PRIORITY_LOW;
+    }
+
+    // The mask is a hint: bits may outlive their events. Clear stale bits,
+    // then re-check in case a producer published in between.
+    uint8_t mask = level_mask.load(std::memory_order_acquire);
+    while (mask != 0) {
+        // Highest set bit = highest non-empty priority
+        int8_t level = 31 - __builtin_clz((uint32_t)mask);
+        if (levelReady(level)) {
+            return level;
+        }
+
+        level_mask.fetch_and((uint8_t)~(1 << level), std::memory_order_acq_rel);
+        if (levelReady(level)) {
+            level_mask.fetch_or((uint8_t)(1 << level), std::memory_order_release);
+            return level;
+        }
+        mask &= ~(1 << level);
+    }
+
+    return -1;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get the next event (highest priority first, FIFO within a level)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool EventQueue::getEvent(Event &event) {
-    if (queue_count == 0) {
+    int8_t level = selectLevel();
+    if (level < 0) {
         return false;  // Queue empty
     }
 
-    // Remove event from queue
-    event = event_queue[queue_head];
-    queue_head = nextIndex(queue_head);
-    queue_count--;
+    if (level == PRIORITY_LOW) {
+        if (low_skips >= EVENT_LOW_MAX_WAIT) {
+            low_promotions++;
+        }
+        low_skips = 0;
+    } else if (levelReady(PRIORITY_LOW)) {
+        low_skips++;
+    }
 
+    levels[level].pop(event);
+    takeCoalesced(event, true);
     return true;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Peek at next event without removing
+// Peek at the event getEvent() would return
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool EventQueue::peekEvent(Event &event) {
-    if (queue_count == 0) {
+    int8_t level = selectLevel();
+    if (level < 0) {
         return false;  // Queue empty
     }
 
-    event = event_queue[queue_head];
+    levels[level].peek(event);
+    takeCoalesced(event, false);
     return true;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Flush all events
+// Flush all events (consumer side; producers may keep posting)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void EventQueue::flush() {
-    queue_count = 0;
-    queue_head = 0;
-    queue_tail = 0;
+    Event discarded;
+    while (getEvent(discarded)) {
+        EventPayloads::releaseEvent(discarded);
+    }
+    low_skips = 0;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Get number of events in queue
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 uint16_t EventQueue::getEventCount() {
-    return queue_count;
+    uint16_t count = 0;
+    for (int i = 0; i < PRIORITY_LEVELS; i++) {
+        count += getEventCount((EventPriority)i);
+    }
+    return count;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get number of events waiting at one priority level (claimed slots included)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint16_t EventQueue::getEventCount(EventPriority priority) {
+    if (priority >= PRIORITY_LEVELS) return 0;
+    return levels[priority].size();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get events dropped at one priority level because it was full
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t EventQueue::getDroppedCount(EventPriority priority) {
+    if (priority >= PRIORITY_LEVELS) return 0;
+    return levels[priority].getDropped();
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Get queue capacity
+// Get queue capacity (all levels)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 uint16_t EventQueue::getQueueCapacity() {
-    return queue_capacity;
+    return levels[0].capacity() * PRIORITY_LEVELS;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Check if queue is empty
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool EventQueue::isEmpty() {
-    return queue_count == 0;
+    return getEventCount() == 0;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Check if queue is full
+// Check if queue is full (every level at capacity)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool EventQueue::isFull() {
-    return queue_count >= queue_capacity;
+    return getEventCount() >= getQueueCapacity();
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Set event filter (enable/disable event type)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void EventQueue::setEventFilter(EventType type, bool enabled) {
-    event_filter[type] = enabled;
+    uint32_t bit = 1u << (type & 31);
+    if (enabled) {
+        event_filter[type >> 5].fetch_or(bit, std::memory_order_relaxed);
+    } else {
+        event_filter[type >> 5].fetch_and(~bit, std::memory_order_relaxed);
+    }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Calculate next circular index
+// Check whether an event type passes the filter
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-uint16_t EventQueue::nextIndex(uint16_t current) {
-    return (current + 1) % queue_capacity;
+bool EventQueue::isEventEnabled(EventType type) {
+    return testBit(event_filter, type);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Set the coalescing policy of an event type
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool EventQueue::setCoalescePolicy(EventType type, CoalescePolicy policy) {
+    CoalesceEntry *entry = findCoalesceEntry(type);
+    uint32_t bit = 1u << (type & 31);
+
+    if (policy == COALESCE_NONE) {
+        if (entry != nullptr) {
+            coalesce_mask[type >> 5].fetch_and(~bit, std::memory_order_release);
+            entry->policy = COALESCE_NONE;
+            entry->type = EVENT_NONE;
+        }
+        return true;
+    }
+
+    if (entry == nullptr) {
+        for (int i = 0; i < MAX_COALESCED_TYPES; i++) {
+            if (coalesce_entries[i].policy == COALESCE_NONE) {
+                entry = &coalesce_entries[i];
+                break;
+            }
+        }
+        if (entry == nullptr) {
+            Serial.printf("[EVENT_QUEUE] No coalescing slot for event type %d\n", type);
+            return false;
+        }
+        entry->state.store(0, std::memory_order_relaxed);
+        entry->type = type;
+    }
+
+    entry->policy = policy;
+    coalesce_mask[type >> 5].fetch_or(bit, std::memory_order_release);
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get the coalescing policy of an event type
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+CoalescePolicy EventQueue::getCoalescePolicy(EventType type) {
+    CoalesceEntry *entry = findCoalesceEntry(type);
+    return entry ? (CoalescePolicy)entry->policy : COALESCE_NONE;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get posts folded into an already queued event
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t EventQueue::getCoalescedCount() {
+    return coalesced_count.load(std::memory_order_relaxed);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Print debug information
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void EventQueue::printDebugInfo() {
+    const char *priority_names[] = { "LOW", "NORMAL", "HIGH", "CRITICAL" };
+    uint16_t count = getEventCount();
+
     Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
     Serial.println("â•‘  EVENT QUEUE DEBUG INFO           â•‘");
     Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
-    Serial.printf("â•‘ Queue Count: %d/%d\n", queue_count, queue_capacity);
-    Serial.printf("â•‘ Queue Head: %d\n", queue_head);
-    Serial.printf("â•‘ Queue Tail: %d\n", queue_tail);
-    Serial.printf("â•‘ Usage: %.1f%%\n", (float)queue_count / queue_capacity * 100.0f);
+    Serial.printf("â•‘ Queue Count: %d/%d\n", count, getQueueCapacity());
+    Serial.printf("â•‘ Usage: %.1f%%\n", (float)count / getQueueCapacity() * 100.0f);
     Serial.printf("â•‘ Empty: %s\n", isEmpty() ? "YES" : "NO");
     Serial.printf("â•‘ Full: %s\n", isFull() ? "YES" : "NO");
+    for (int i = PRIORITY_LEVELS - 1; i >= 0; i--) {
+        Serial.printf("â•‘ %-8s %3d/%d, dropped %u\n",
+            priority_names[i], getEventCount((EventPriority)i), (int)levels[i].capacity(),
+            getDroppedCount((EventPriority)i));
+    }
+    Serial.printf("â•‘ LOW starvation promotions: %u\n", low_promotions);
+    Serial.printf("â•‘ Coalesced posts: %u\n", getCoalescedCount());
+    Serial.printf("â•‘ Payloads: %d/%d, peak %d, failed %u\n",
+        EventPayloads::getUsedCount(), EventPayloads::getCapacity(),
+        EventPayloads::getPeakCount(), EventPayloads::getFailedCount());
     Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
 }
 
@@ -166,7 +451,7 @@ void EventQueue::printDebugInfo() {
 // Print queue contents
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void EventQueue::printQueue() {
-    if (queue_count == 0) {
+    if (isEmpty()) {
         Serial.println("[EVENT_QUEUE] Queue is empty");
         return;
     }
@@ -185,12 +470,14 @@ void EventQueue::printQueue() {
 
     const char *priority_names[] = { "LOW", "NORMAL", "HIGH", "CRITICAL" };
 
+    // Listed highest priority first, FIFO within a level (consumer side only)
     Serial.println("[EVENT_QUEUE] Queue Contents:");
-    uint16_t idx = queue_head;
-    for (uint16_t i = 0; i < queue_count; i++) {
-        Event &evt = event_queue[idx];
-        Serial.printf("  [%d] Type=%d Priority=%s Data1=%d Data2=%d\n",
-            i, evt.type, priority_names[evt.priority], evt.data1, evt.data2);
-        idx = nextIndex(idx);
+    uint16_t n = 0;
+    for (int level = PRIORITY_LEVELS - 1; level >= 0; level--) {
+        Event evt;
+        for (uint32_t index = 0; levels[level].peek(evt, index); index++) {
+            Serial.printf("  [%d] Type=%d Priority=%s Data1=%d Data2=%d\n",
+                n++, evt.type, priority_names[level], evt.data1, evt.data2);
+        }
     }
 }
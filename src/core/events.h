@@ -2,6 +2,9 @@
 #define IONOS_EVENTS_H
 
 #include <stdint.h>
+#include <atomic>
+#include "../config/system_config.h"
+#include "mpsc_ring.h"
 
 // ============================================================================
 // ionOS v1.0 - EVENT SYSTEM
@@ -16,6 +19,8 @@ enum EventType {
     EVENT_SYSTEM_TICK = 2,
     EVENT_SYSTEM_ERROR = 3,
     EVENT_SYSTEM_WARNING = 4,
+    EVENT_SYSTEM_ALARM = 5,            // data1: TimeService alarm index
+    EVENT_SYSTEM_DEVICE = 6,           // data1: DeviceId, data2: new DeviceStatus
 
     // Button events (6-button layout: UP, DOWN, LEFT, RIGHT, SELECT, BACK)
     EVENT_BUTTON_PRESS = 10,           // Short press
@@ -47,9 +52,11 @@ enum EventType {
     EVENT_NETWORK_CONNECTED = 60,
     EVENT_NETWORK_DISCONNECTED = 61,
     EVENT_NETWORK_ERROR = 62,
+    EVENT_NETWORK_RESPONSE = 63,       // data3: EventPayload with the response body
 
     // Storage events
     EVENT_STORAGE_ERROR = 70,
+    EVENT_STORAGE_READ = 71,           // data3: EventPayload with file data, data1: 1 if truncated
 
     // Audio events
     EVENT_AUDIO_PLAY = 80,
@@ -79,7 +86,7 @@ struct Event {
     uint32_t timestamp;       // When it happened (millis())
     uint8_t data1;           // Generic data field 1
     uint8_t data2;           // Generic data field 2
-    void *data3;             // Generic pointer (for larger data)
+    void *data3;             // Generic pointer, or an EventPayload (event_payload.h)
 };
 
 // Button IDs (matching 6-button layout)
@@ -92,45 +99,91 @@ enum ButtonID {
     BTN_ID_BACK = 5
 };
 
-// Event queue manager
+// Coalescing policy: while an event of the type is queued, further posts
+// update it in place instead of taking another slot
+enum CoalescePolicy {
+    COALESCE_NONE = 0,
+    COALESCE_LATEST = 1,      // Newest data1/data2 replace the pending ones
+    COALESCE_ACCUMULATE = 2,  // data1/data2 are summed (saturating at 255)
+    COALESCE_BITS = 3         // data1/data2 are OR'ed (dirty flags)
+};
+
+// Pending state of one coalesced type: COALESCE_PENDING | data2 << 8 | data1
+struct CoalesceEntry {
+    uint8_t type;
+    uint8_t policy;
+    std::atomic<uint32_t> state;
+    std::atomic<uint32_t> timestamp;  // Newest merged post
+};
+
+// Event queue manager (multi-producer, single consumer: the kernel loop)
 class EventQueue {
 public:
     // Initialization
     static bool init(uint16_t queue_size = 64);
     static void shutdown();
 
-    // Queue operations
+    // Queue operations (post from any task; get/peek/flush from the kernel loop).
+    // A posted EventPayload belongs to the queue, even when the post fails;
+    // getEvent() hands it to the caller.
     static bool postEvent(const Event &event);
-    static bool getEvent(Event &event);  // FIFO - removes from queue
+    static bool postEventFromISR(const Event &event);  // Never logs; also fine from tasks
+    static bool getEvent(Event &event);  // Highest priority first, FIFO within a level
     static bool peekEvent(Event &event); // Peek without removing
     static void flush();                 // Clear all events
 
     // Queue state
     static uint16_t getEventCount();
+    static uint16_t getEventCount(EventPriority priority);
+    static uint32_t getDroppedCount(EventPriority priority);
     static uint16_t getQueueCapacity();
     static bool isEmpty();
     static bool isFull();
 
     // Event filtering (optional)
     static void setEventFilter(EventType type, bool enabled);
+    static bool isEventEnabled(EventType type);
+
+    // Coalescing (configure before producers start; posts with data3 set
+    // are never coalesced)
+    static bool setCoalescePolicy(EventType type, CoalescePolicy policy);
+    static CoalescePolicy getCoalescePolicy(EventType type);
+    static uint32_t getCoalescedCount();
 
     // Debug
     static void printDebugInfo();
     static void printQueue();
 
 private:
-    static const uint16_t MAX_QUEUE_SIZE = 256;
-    static Event event_queue[MAX_QUEUE_SIZE];
-    static uint16_t queue_head;
-    static uint16_t queue_tail;
-    static uint16_t queue_count;
-    static uint16_t queue_capacity;
+    static const uint16_t MAX_QUEUE_SIZE = MAX_EVENTS;
+    static const uint8_t PRIORITY_LEVELS = 4;
+    static const uint16_t LEVEL_SLOTS = MAX_QUEUE_SIZE / PRIORITY_LEVELS;  // Power of two
+
+    // One MPSC ring per priority; bit p of level_mask is set once level p
+    // has a published event (cleared lazily by the consumer)
+    static MpscRing<Event, LEVEL_SLOTS> levels[PRIORITY_LEVELS];
+    static std::atomic<uint8_t> level_mask;
+
+    // LOW starvation bound
+    static uint16_t low_skips;          // Dequeues that passed a waiting LOW event
+    static uint32_t low_promotions;
+
+    // Event filtering: one bit per EventType, set = enabled
+    static std::atomic<uint32_t> event_filter[256 / 32];
 
-    // Event filtering
-    static bool event_filter[256];
+    // Coalescing: bitmap of types with a policy, then their entries
+    static std::atomic<uint32_t> coalesce_mask[256 / 32];
+    static CoalesceEntry coalesce_entries[MAX_COALESCED_TYPES];
+    static std::atomic<uint32_t> coalesced_count;
 
     // Internal helpers
-    static uint16_t nextIndex(uint16_t current);
+    static bool push(const Event &event);
+    static bool testBit(const std::atomic<uint32_t> *bits, uint8_t index);
+    static CoalesceEntry* findCoalesceEntry(uint8_t type);
+    static bool mergeCoalesced(CoalesceEntry &entry, const Event &event);
+    static void takeCoalesced(Event &event, bool consume);
+    static bool levelReady(uint8_t level);
+    static int8_t selectLevel();
 };
 
 #endif // IONOS_EVENTS_H
@@ -1,38 +1,96 @@
 #include "kernel.h"
 #include "power.h"
+#include "event_payload.h"
+#include "memory.h"
+#include "boot_timeline.h"
 #include "../config/system_config.h"
+#include "../config/version.h"
+#include "../apps/app_base.h"
 #include "../drivers/button_driver.h"
 #include "../drivers/battery_driver.h"
 #include "../drivers/display_driver.h"
 #include "../drivers/rtc_driver.h"
 
+#ifdef IONOS_NATIVE
+#include <pthread.h>
+#include <limits.h>
+#endif
+
 // ============================================================================
 // ionOS v1.0 - KERNEL IMPLEMENTATION
 // Event-driven core with app lifecycle management
 // ============================================================================
 
 // Static member initialization
-bool Kernel::running = false;
+std::atomic<bool> Kernel::running(false);
 bool Kernel::initialized = false;
-AppInstance Kernel::apps[Kernel::MAX_APPS];
+bool Kernel::multicore = false;
+AppInstance Kernel::apps[MAX_APPS];
 uint8_t Kernel::active_app_id = 0;
+AppSnapshotWriteFn Kernel::snapshot_write = nullptr;
+AppSnapshotReadFn Kernel::snapshot_read = nullptr;
+std::atomic<bool> Kernel::trim_requested(false);
+uint32_t Kernel::last_switch_us = 0;
+bool Kernel::last_switch_warm = false;
 uint32_t Kernel::tick_count = 0;
 uint32_t Kernel::last_loop_time = 0;
+DeviceState Kernel::devices[DEVICE_COUNT];
 uint32_t Kernel::loop_start_time = 0;
+uint32_t Kernel::phase_samples[PHASE_COUNT + 1][Kernel::PROFILE_WINDOW];
+KernelTask Kernel::tasks[MAX_KERNEL_TASKS];
+uint8_t Kernel::task_count = 0;
+RunnerStats Kernel::runner_stats[RUNNER_COUNT];
+#ifndef IONOS_NATIVE
+TaskHandle_t Kernel::runner_tasks[RUNNER_COUNT] = { nullptr };
+#endif
+uint16_t Kernel::profile_head[PHASE_COUNT + 1] = { 0 };
+uint16_t Kernel::profile_count[PHASE_COUNT + 1] = { 0 };
+uint32_t Kernel::frame_overruns = 0;
+uint32_t Kernel::frames_skipped = 0;
+EventSubscriber Kernel::subscribers[MAX_EVENT_SUBSCRIBERS];
+uint8_t Kernel::subscriber_head[256];
+uint8_t Kernel::subscriber_free = Kernel::NO_SUBSCRIBER;
+uint32_t Kernel::events_dispatched = 0;
+uint32_t Kernel::dispatch_deferrals = 0;
+
+static const char* const phase_names[PHASE_COUNT] = {
+    "buttons", "power", "events", "apps", "battery", "render", "flush", "memory", "services"
+};
+
+static const char* const runner_names[RUNNER_COUNT] = { "realtime", "service", "stream" };
+
+static const char* const device_names[DEVICE_COUNT] = { "display", "buttons", "battery", "rtc", "power" };
+static const char* const device_status_names[] = { "absent", "degraded", "present" };
+
+// Device init (and retry) functions, and what a failure leaves behind
+static bool (*const device_init[DEVICE_COUNT])() = {
+    DisplayDriver::init, ButtonDriver::init, BatteryDriver::init, RTCDriver::init, PowerManager::init
+};
+static const DeviceStatus device_fallback[DEVICE_COUNT] = {
+    DEVICE_ABSENT, DEVICE_ABSENT, DEVICE_ABSENT, DEVICE_DEGRADED, DEVICE_ABSENT
+};
 
-// Forward declarations for app interface (defined elsewhere)
-class App {
-public:
-    virtual ~App() {}
-    virtual void onLaunch() {}
-    virtual void onClose() {}
-    virtual void onSuspend() {}
-    virtual void onResume() {}
-    virtual void onEvent(const Event &event) {}
-    virtual void update() {}
-    virtual void render() {}
-    virtual const char* getName() { return "App"; }
+static const uint32_t FRAME_PERIOD_US = 1000000UL / DISPLAY_FPS;
+
+#ifdef IONOS_NATIVE
+// Runner threads block on a condition variable (host time, not sim time)
+static pthread_t runner_threads[RUNNER_COUNT];
+static pthread_mutex_t runner_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t runner_cond[RUNNER_COUNT] = {
+    PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER
 };
+static bool runner_wake[RUNNER_COUNT];
+static bool runner_started[RUNNER_COUNT];
+static thread_local uint8_t current_runner = RUNNER_REALTIME;
+#endif
+
+// Run one init step as a named boot timeline stage
+static bool runBootStage(const char *name, bool (*init_fn)()) {
+    uint8_t stage = BootTimeline::begin(name);
+    bool ok = init_fn();
+    BootTimeline::end(stage, ok);
+    return ok;
+}
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Initialize kernel
@@ -42,56 +100,196 @@ bool Kernel::init() {
         return true;
     }
 
-    // Initialize event queue
+    // Boot arena first: drivers allocate from it
+    if (!runBootStage("memory", MemoryManager::init)) {
+        Serial.println("[KERNEL] Memory manager init failed!");
+        return false;
+    }
+
+    // Initialize event queue (services subscribe during their init)
     EventQueue::init();
+    resetSubscribers();
 
     // Initialize all drivers in correct order
     Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
     Serial.println("â•‘  ionOS v1.0 - KERNEL STARTUP     â•‘");
     Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
 
-    if (!DisplayDriver::init()) {
-        Serial.println("[KERNEL] Display init failed!");
-        return false;
+    // Devices that fail are retried later; boot carries on without them
+    for (uint8_t i = 0; i < DEVICE_COUNT; i++) {
+        devices[i].status = DEVICE_ABSENT;
+        devices[i].failures = 0;
+        devices[i].retry_ms = 0;
+        devices[i].backoff_ms = DEVICE_RETRY_MIN_MS;
     }
 
-    if (!ButtonDriver::init()) {
-        Serial.println("[KERNEL] Button init failed!");
-        return false;
-    }
+    // The battery ADC settles while the display is brought up over I2C
+    uint8_t battery_stage = BootTimeline::begin("battery");
+    BatteryDriver::beginInit();
 
-    if (!BatteryDriver::init()) {
-        Serial.println("[KERNEL] Battery init failed!");
-        return false;
-    }
+    bool display_ok = bootDevice(DEVICE_DISPLAY);
 
-    if (!RTCDriver::init()) {
-        Serial.println("[KERNEL] RTC init failed!");
-        return false;
+#if BOOT_SPLASH
+    // Something on screen before the slower bring-up finishes
+    if (display_ok) {
+        uint8_t splash_stage = BootTimeline::begin("splash");
+        showSplash();
+        BootTimeline::end(splash_stage);
     }
+#else
+    (void)display_ok;
+#endif
 
-    if (!PowerManager::init()) {
-        Serial.println("[KERNEL] Power manager init failed!");
-        return false;
-    }
+    bootDevice(DEVICE_BUTTONS);
+
+    bool battery_ok = BatteryDriver::finishInit();
+    BootTimeline::end(battery_stage, battery_ok);
+    setDeviceStatus(DEVICE_BATTERY, battery_ok);
+
+    // Shares the I2C bus with the display, so it cannot overlap it
+    bootDevice(DEVICE_RTC);
+    bootDevice(DEVICE_POWER);
 
     // Initialize app array
     for (int i = 0; i < MAX_APPS; i++) {
         apps[i].app = nullptr;
         apps[i].state = APP_STATE_INACTIVE;
         apps[i].launch_time = 0;
+        apps[i].suspend_time = 0;
         apps[i].app_id = i;
+        apps[i].trimmed = false;
     }
 
+    // BACK from any app that doesn't handle it returns home
+    subscribe(EVENT_APP_BACK, onAppBack);
+
     active_app_id = 0;
     tick_count = 0;
     loop_start_time = millis();
 
+    // Built-in tasks, registered in KernelPhase order so task id == phase
+    task_count = 0;
+#if BTN_USE_INTERRUPTS
+    // Edges wake the task from the ISR; the period only drives debounce
+    // settling and long-press detection
+    addBuiltinTask("buttons", pollButtons, BTN_SERVICE_INTERVAL_US, false, RUNNER_REALTIME);
+#else
+    addBuiltinTask("buttons", pollButtons, BTN_POLL_INTERVAL_US, false, RUNNER_REALTIME);
+#endif
+    // Power checks only post events, so they can live on the service core
+    addBuiltinTask("power", handlePowerEvents, POWER_CHECK_INTERVAL_MS * 1000UL, false, RUNNER_SERVICE);
+    addBuiltinTask("events", dispatchEvents, 0, true, RUNNER_REALTIME);
+    addBuiltinTask("apps", updateApps, FRAME_PERIOD_US, false, RUNNER_REALTIME);
+    addBuiltinTask("battery", BatteryDriver::update, BAT_SAMPLE_INTERVAL_MS * 1000UL, false, RUNNER_SERVICE);
+    addBuiltinTask("render", renderDisplay, FRAME_PERIOD_US, true, RUNNER_REALTIME);
+    addBuiltinTask("flush", flushDisplay, 0, true, RUNNER_REALTIME);
+    addBuiltinTask("memory", manageMemory, MEMORY_CHECK_INTERVAL_MS * 1000UL, false, RUNNER_SERVICE);
+
+    // Device retries stay on the loop: a display re-init must not race the
+    // render and flush tasks, and the I2C probes take well under a millisecond
+    addBuiltinTask("devices", retryDevices, DEVICE_RETRY_MIN_MS * 1000UL, false, RUNNER_REALTIME);
+
     initialized = true;
     Serial.println("\n[KERNEL] âœ“ All systems initialized\n");
     return true;
 }
 
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Boot splash: the first frame, replaced by the home app's first render
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::showSplash() {
+    // 6x10 font, centered on the 128x64 panel
+    DisplayDriver::clear();
+    DisplayDriver::drawString(49, 30, "ionOS", true);
+    DisplayDriver::drawString(37, 44, IONOS_DEVICE_NAME, true);
+    DisplayDriver::display();
+    BootTimeline::markFirstFrame();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Init one device as a boot stage and record its status
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::bootDevice(uint8_t device) {
+    bool ok = runBootStage(device_names[device], device_init[device]);
+    setDeviceStatus(device, ok);
+    return ok;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Record an init result; failures schedule a retry with backoff
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::setDeviceStatus(uint8_t device, bool ok) {
+    DeviceState &state = devices[device];
+    DeviceStatus previous = state.status;
+
+    if (ok) {
+        if (state.failures > 0) {
+            Serial.printf("[KERNEL] %s recovered after %u failed init(s)\n",
+                device_names[device], state.failures);
+        }
+        state.status = DEVICE_PRESENT;
+        state.failures = 0;
+        state.backoff_ms = DEVICE_RETRY_MIN_MS;
+    } else {
+        state.status = device_fallback[device];
+        if (state.failures < UINT16_MAX) state.failures++;
+        state.retry_ms = millis() + state.backoff_ms;
+        Serial.printf("[KERNEL] %s init failed, %s; retry in %lu ms\n", device_names[device],
+            device_status_names[state.status], (unsigned long)state.backoff_ms);
+
+        state.backoff_ms *= 2;
+        if (state.backoff_ms > DEVICE_RETRY_MAX_MS) {
+            state.backoff_ms = DEVICE_RETRY_MAX_MS;
+        }
+    }
+
+    // Boot-time results are in the info box; later changes are news
+    if (initialized && state.status != previous) {
+        Event event = {
+            .type = EVENT_SYSTEM_DEVICE,
+            .priority = PRIORITY_NORMAL,
+            .timestamp = millis(),
+            .data1 = device,
+            .data2 = (uint8_t)state.status,
+            .data3 = nullptr
+        };
+        postEvent(event);
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Re-initialize devices whose retry time has come (scheduler task)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::retryDevices() {
+    uint32_t now = millis();
+
+    for (uint8_t i = 0; i < DEVICE_COUNT; i++) {
+        DeviceState &state = devices[i];
+        if (state.status == DEVICE_PRESENT || (int32_t)(now - state.retry_ms) < 0) {
+            continue;
+        }
+
+        bool ok = device_init[i]();
+        setDeviceStatus(i, ok);
+
+        // A panel that came back starts blank
+        if (ok && i == DEVICE_DISPLAY) {
+            requestRender();
+        }
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Device status
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+DeviceStatus Kernel::getDeviceStatus(uint8_t device) {
+    return device < DEVICE_COUNT ? devices[device].status : DEVICE_ABSENT;
+}
+
+const char* Kernel::getDeviceName(uint8_t device) {
+    return device < DEVICE_COUNT ? device_names[device] : "?";
+}
+
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Startup kernel (called after init)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -102,14 +300,36 @@ bool Kernel::startup() {
 
     running = true;
 
+    // Every periodic task is due immediately; draw the first frame
+    uint32_t now = micros();
+    for (uint8_t i = 0; i < task_count; i++) {
+        tasks[i].next_run_us = now;
+    }
+    requestRender();
+
+#ifndef IONOS_NATIVE
+    runner_tasks[RUNNER_REALTIME] = xTaskGetCurrentTaskHandle();
+#endif
+    ButtonDriver::setEdgeCallback(wakeFromISR);
+
+    // Boot is over: anything allocated from here on comes from the pools
+    MemoryManager::seal();
+    MemoryManager::sample();
+
+    memset(runner_stats, 0, sizeof(runner_stats));
+    runner_stats[RUNNER_REALTIME].start_us = now;
+#if KERNEL_MULTICORE
+    multicore = startRunners();
+#endif
+
     // Post startup event
     Event startup_event = {
-        .type = EVENT_SYSTEM_STARTUP,
+        .type = EVENT_SYSTEM_INIT,
         .priority = PRIORITY_CRITICAL,
         .timestamp = millis(),
         .data1 = 0,
         .data2 = 0,
-        .ptr = nullptr
+        .data3 = nullptr
     };
     postEvent(startup_event);
 
@@ -122,6 +342,8 @@ bool Kernel::startup() {
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void Kernel::shutdown() {
     running = false;
+    ButtonDriver::setEdgeCallback(nullptr);
+    stopRunners();
 
     // Close all apps
     for (int i = 0; i < MAX_APPS; i++) {
@@ -155,27 +377,384 @@ void Kernel::tick() {
 
     loop_start_time = millis();
 
-    // 1. Handle input (buttons)
-    ButtonDriver::update();
-    handleButtonEvents();
+    // Without runner tasks the loop runs every task itself
+    uint32_t tick_us = runTasks(multicore ? RUNNER_REALTIME : RUNNER_COUNT);
+    recordSample(PHASE_COUNT, tick_us);
+    if (tick_us > FRAME_PERIOD_US) {
+        frame_overruns++;
+    }
 
-    // 2. Handle power events
-    handlePowerEvents();
+    // Input polled, events dispatched and the home app drawn
+    if (tick_count == 0) {
+        BootTimeline::markInteractive();
+    }
 
-    // 3. Update active app
-    updateApps();
+    tick_count++;
+    last_loop_time = tick_us / 1000;
+}
 
-    // 4. Update battery status
-    BatteryDriver::update();
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Run the due tasks of one runner (RUNNER_COUNT = all); returns elapsed us
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t Kernel::runTasks(uint8_t runner) {
+    uint32_t start = micros();
+    uint32_t now = start;
+    uint32_t services_us = 0;
+    bool services_ran = false;
+
+    // Run every task whose deadline has passed, in registration order
+    for (uint8_t i = 0; i < task_count; i++) {
+        KernelTask &task = tasks[i];
+        if (runner != RUNNER_COUNT && task.runner != runner) {
+            continue;
+        }
+        if (!isTaskDue(task, now)) {
+            continue;
+        }
 
-    // 5. Render display
-    renderDisplay();
+        // Keep a steady cadence, but don't try to catch up after a stall.
+        // A deadline moved by setTaskPeriod() meanwhile wins over ours.
+        uint32_t deadline = task.next_run_us.load();
+        uint32_t period = task.period_us.load();
+        uint32_t next = deadline + period;
+        if ((int32_t)(now - next) >= 0) {
+            next = now + period;
+        }
+        task.next_run_us.compare_exchange_strong(deadline, next);
+        task.signaled = false;
+
+        task.run();
+
+        uint32_t end = micros();
+        if (i < PHASE_SERVICES) {
+            recordSample(i, end - now);
+        } else if (runner == RUNNER_COUNT || runner == RUNNER_SERVICE) {
+            // One writer per profiler row: the services row belongs to the
+            // service runner; other runners only count their own load
+            services_us += end - now;
+            services_ran = true;
+        }
+        now = end;
+    }
 
-    // 6. Memory management
-    manageMemory();
+    if (services_ran) {
+        recordSample(PHASE_SERVICES, services_us);
+    }
 
-    tick_count++;
-    last_loop_time = (millis() - loop_start_time);
+    uint32_t elapsed = now - start;
+    uint8_t stats_runner = (runner == RUNNER_COUNT) ? RUNNER_REALTIME : (KernelRunner)runner;
+    runner_stats[stats_runner].loops++;
+    runner_stats[stats_runner].busy_us += elapsed;
+    return elapsed;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Check whether a task should run at time now
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::isTaskDue(const KernelTask &task, uint32_t now) {
+    if (task.signaled) {
+        // A signaled periodic task runs now; on-demand ones stay rate-limited
+        if (!task.on_demand) {
+            return true;
+        }
+    } else if (task.on_demand) {
+        return false;
+    }
+    return (int32_t)(now - task.next_run_us) >= 0;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Register a built-in task (init only)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::addBuiltinTask(const char *name, KernelTaskFn fn, uint32_t period_us, bool on_demand,
+                            KernelRunner runner) {
+    KernelTask &task = tasks[task_count++];
+    task.name = name;
+    task.run = fn;
+    task.period_us = period_us;
+    task.next_run_us = 0;
+    task.on_demand = on_demand;
+    task.signaled = false;
+    task.runner = runner;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Register a service task; returns its id or -1 if the table is full
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+int8_t Kernel::registerTask(const char *name, KernelTaskFn fn, uint32_t period_us, bool on_demand,
+                            KernelRunner runner) {
+    // The table is read by the runner tasks, so it only grows before startup()
+    if (!initialized || running || fn == nullptr || task_count >= MAX_KERNEL_TASKS ||
+        runner >= RUNNER_COUNT) {
+        Serial.printf("[KERNEL] Cannot register task %s\n", name ? name : "?");
+        return -1;
+    }
+
+    uint8_t id = task_count;
+    addBuiltinTask(name, fn, period_us, on_demand, runner);
+    tasks[id].next_run_us = micros();
+    return id;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Change a task period (microseconds)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::setTaskPeriod(uint8_t task_id, uint32_t period_us) {
+    if (task_id >= task_count) {
+        return false;
+    }
+
+    tasks[task_id].period_us = period_us;
+    tasks[task_id].next_run_us = micros() + period_us;
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Wake an on-demand task at its next allowed slot
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::signalTask(uint8_t task_id) {
+    if (task_id < task_count) {
+        tasks[task_id].signaled = true;
+        wakeRunner(tasks[task_id].runner);
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Ask for a redraw (rate-limited to DISPLAY_FPS)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::requestRender() {
+    signalTask(PHASE_RENDER);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Time until the earliest runnable deadline
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t Kernel::getTimeToNextDeadline() {
+    return getTimeToNextDeadline(multicore ? RUNNER_REALTIME : RUNNER_COUNT);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Time until the earliest runnable deadline of one runner (RUNNER_COUNT = all)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t Kernel::getTimeToNextDeadline(uint8_t runner) {
+    uint32_t now = micros();
+    uint32_t wait = UINT32_MAX;
+
+    for (uint8_t i = 0; i < task_count; i++) {
+        const KernelTask &task = tasks[i];
+        if (runner != RUNNER_COUNT && task.runner != runner) {
+            continue;
+        }
+        if (task.on_demand && !task.signaled) {
+            continue;
+        }
+        if (task.signaled && !task.on_demand) {
+            return 0;
+        }
+
+        int32_t remaining = (int32_t)(task.next_run_us - now);
+        if (remaining <= 0) {
+            return 0;
+        }
+        if ((uint32_t)remaining < wait) {
+            wait = remaining;
+        }
+    }
+
+    return wait;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Sleep until the next task is due
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::waitForNextDeadline() {
+    uint32_t wait_us = getTimeToNextDeadline();
+    if (wait_us == 0) {
+        yield();
+        return;
+    }
+
+#ifdef IONOS_NATIVE
+    // Virtual clock: land exactly on the deadline
+    delayMicroseconds(wait_us);
+#else
+    // Blocking lets FreeRTOS idle (and light sleep) instead of spinning.
+    // Round up to whole ticks so the loop never wakes before the deadline
+    // and spins out the remainder; a notification from wakeFromISR() cuts
+    // the wait short.
+    const uint32_t tick_us = portTICK_PERIOD_MS * 1000;
+    TickType_t ticks = wait_us / tick_us + (wait_us % tick_us != 0);
+    ulTaskNotifyTake(pdTRUE, ticks);
+#endif
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Button edge ISR hook: mark the buttons task due and wake the loop
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void IRAM_ATTR Kernel::wakeFromISR() {
+    notifyLoopFromISR(PHASE_BUTTONS);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Signal a task from an ISR and wake the loop if it is blocked
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void IRAM_ATTR Kernel::notifyLoopFromISR(uint8_t task_id) {
+    // Lock-free atomic store; runTasks() clears it before running the task
+    tasks[task_id].signaled = true;
+
+#ifndef IONOS_NATIVE
+    TaskHandle_t loop_task = runner_tasks[RUNNER_REALTIME];
+    if (loop_task != nullptr) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(loop_task, &woken);
+        if (woken == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+    }
+#endif
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Check whether the service/stream runner tasks are running
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::isMulticore() {
+    return multicore;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Spawn the service and stream runner tasks
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::startRunners() {
+    static const uint8_t cores[RUNNER_COUNT] = { 1, SERVICE_TASK_CORE, STREAM_TASK_CORE };
+    static const uint32_t stacks[RUNNER_COUNT] = { 0, SERVICE_TASK_STACK, STREAM_TASK_STACK };
+#ifndef IONOS_NATIVE
+    static const UBaseType_t priorities[RUNNER_COUNT] = { 0, SERVICE_TASK_PRIORITY, STREAM_TASK_PRIORITY };
+#endif
+
+    for (uint8_t r = RUNNER_SERVICE; r < RUNNER_COUNT; r++) {
+        runner_stats[r].start_us = micros();
+
+#ifdef IONOS_NATIVE
+        runner_wake[r] = false;
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        size_t stack = stacks[r] < PTHREAD_STACK_MIN ? PTHREAD_STACK_MIN : stacks[r];
+        pthread_attr_setstacksize(&attr, stack);
+        int err = pthread_create(&runner_threads[r], &attr,
+                                 [](void *arg) -> void* { runnerMain(arg); return nullptr; },
+                                 (void*)(uintptr_t)r);
+        pthread_attr_destroy(&attr);
+        runner_started[r] = (err == 0);
+        if (err != 0) {
+#else
+        if (xTaskCreatePinnedToCore(runnerMain, runner_names[r], stacks[r], (void*)(uintptr_t)r,
+                                    priorities[r], &runner_tasks[r], cores[r]) != pdPASS) {
+#endif
+            Serial.printf("[KERNEL] Failed to start %s runner, running its tasks from loop()\n", runner_names[r]);
+            stopRunners();
+            return false;
+        }
+
+        Serial.printf("[KERNEL] %s runner on core %d (%lu byte stack)\n",
+            runner_names[r], cores[r], (unsigned long)stacks[r]);
+    }
+
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Stop the runner tasks (they exit after their current pass)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::stopRunners() {
+    multicore = false;
+
+    for (uint8_t r = RUNNER_SERVICE; r < RUNNER_COUNT; r++) {
+#ifdef IONOS_NATIVE
+        if (!runner_started[r]) continue;
+        wakeRunner(r);
+        pthread_join(runner_threads[r], nullptr);
+        runner_started[r] = false;
+#else
+        if (runner_tasks[r] == nullptr) continue;
+        xTaskNotifyGive(runner_tasks[r]);
+#endif
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Runner task body: run due tasks, then block until the next deadline
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::runnerMain(void *arg) {
+    uint8_t runner = (uint8_t)(uintptr_t)arg;
+#ifdef IONOS_NATIVE
+    current_runner = runner;
+#endif
+
+    while (running) {
+        runTasks(runner);
+        waitRunner(runner, getTimeToNextDeadline(runner));
+    }
+
+#ifndef IONOS_NATIVE
+    runner_tasks[runner] = nullptr;
+    vTaskDelete(nullptr);
+#endif
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Block a runner task until its deadline or a wakeRunner()
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::waitRunner(uint8_t runner, uint32_t wait_us) {
+    if (wait_us == 0) {
+        return;
+    }
+
+#ifdef IONOS_NATIVE
+    // Sim time can jump ahead of host time, so never sleep long
+    if (wait_us > RUNNER_NATIVE_MAX_WAIT_US) {
+        wait_us = RUNNER_NATIVE_MAX_WAIT_US;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += (long)wait_us * 1000;
+    deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+    deadline.tv_nsec %= 1000000000L;
+
+    pthread_mutex_lock(&runner_lock);
+    while (!runner_wake[runner] && running) {
+        if (pthread_cond_timedwait(&runner_cond[runner], &runner_lock, &deadline) != 0) {
+            break;  // Timed out
+        }
+    }
+    runner_wake[runner] = false;
+    pthread_mutex_unlock(&runner_lock);
+#else
+    // At least one tick, so a sub-tick deadline still yields the core
+    TickType_t ticks = pdMS_TO_TICKS(wait_us / 1000);
+    ulTaskNotifyTake(pdTRUE, ticks > 0 ? ticks : 1);
+#endif
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Wake a runner blocked in its wait (no-op for the calling runner)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::wakeRunner(uint8_t runner) {
+#ifdef IONOS_NATIVE
+    // The native loop runner waits with delay(), which sim time cuts short
+    if (runner == RUNNER_REALTIME || runner == current_runner) {
+        return;
+    }
+    pthread_mutex_lock(&runner_lock);
+    runner_wake[runner] = true;
+    pthread_cond_signal(&runner_cond[runner]);
+    pthread_mutex_unlock(&runner_lock);
+#else
+    TaskHandle_t handle = runner_tasks[runner];
+    if (handle != nullptr && handle != xTaskGetCurrentTaskHandle()) {
+        xTaskNotifyGive(handle);
+    }
+#endif
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -190,51 +769,110 @@ void Kernel::run() {
     while (isRunning()) {
         tick();
 
-        // Yield to other tasks (if using FreeRTOS)
-        yield();
-
-        // Target loop frequency
-        uint32_t frame_time = 1000 / DISPLAY_FPS;  // ~16ms for 60fps
-        if (last_loop_time < frame_time) {
-            delay(frame_time - last_loop_time);
-        }
+        // Sleep until the earliest task deadline
+        waitForNextDeadline();
     }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Launch app
+// Launch app (or resume it if it is suspended)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool Kernel::launchApp(App *app, uint8_t app_id) {
     if (app_id >= MAX_APPS || app == nullptr) {
         return false;
     }
 
-    // Suspend current app
-    if (apps[active_app_id].app != nullptr && apps[active_app_id].state == APP_STATE_RUNNING) {
-        apps[active_app_id].app->onSuspend();
-        apps[active_app_id].state = APP_STATE_SUSPENDED;
+    AppInstance &target = apps[app_id];
+    if (app_id == active_app_id && target.app == app && target.state == APP_STATE_RUNNING) {
+        return true;  // Already in front
+    }
+
+    uint32_t start = micros();
+
+    // Suspend current app; it keeps its state in RAM
+    AppInstance &current = apps[active_app_id];
+    if (app_id != active_app_id && current.app != nullptr && current.state == APP_STATE_RUNNING) {
+        current.app->onSuspend();
+        current.app->setState(APP_STATE_SUSPENDED);
+        current.state = APP_STATE_SUSPENDED;
+        current.suspend_time = millis();
+        postAppEvent(EVENT_APP_SUSPEND, active_app_id);
     }
 
-    // Set new active app
     active_app_id = app_id;
-    apps[app_id].app = app;
-    apps[app_id].state = APP_STATE_RUNNING;
-    apps[app_id].launch_time = millis();
 
-    // Call app's launch hook
-    app->onLaunch();
+    // Warm switch: no onLaunch(), the app picks up where it left off
+    bool warm = (target.app == app && target.state == APP_STATE_SUSPENDED && resumeApp(app_id));
 
-    Event launch_event = {
-        .type = EVENT_APP_LAUNCH,
-        .priority = PRIORITY_NORMAL,
-        .timestamp = millis(),
-        .data1 = app_id,
-        .data2 = 0,
-        .ptr = app
-    };
-    postEvent(launch_event);
+    if (!warm) {
+        // A different app in this slot is closed first
+        if (target.app != nullptr && target.app != app && target.state != APP_STATE_INACTIVE) {
+            target.app->onClose();
+            target.app->setState(APP_STATE_INACTIVE);
+        }
+
+        target.app = app;
+        target.state = APP_STATE_RUNNING;
+        target.launch_time = millis();
+        target.trimmed = false;
+
+        // Call app's launch hook
+        app->setState(APP_STATE_RUNNING);
+        app->onLaunch();
+        postAppEvent(EVENT_APP_LAUNCH, app_id);
+    }
+
+    requestRender();
 
-    Serial.printf("[KERNEL] Launched app %d: %s\n", app_id, app->getName());
+    last_switch_us = micros() - start;
+    last_switch_warm = warm;
+    Serial.printf("[KERNEL] %s app %d: %s (%lu us)\n", warm ? "Resumed" : "Launched",
+        app_id, app->getName(), (unsigned long)last_switch_us);
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Bring an app that is already in the table to the front
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::switchToApp(uint8_t app_id) {
+    if (app_id >= MAX_APPS || apps[app_id].app == nullptr) {
+        return false;
+    }
+    return launchApp(apps[app_id].app, app_id);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Resume a suspended app (restores its snapshot if it was trimmed)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::resumeApp(uint8_t app_id) {
+    AppInstance &instance = apps[app_id];
+
+    if (instance.trimmed) {
+        instance.trimmed = false;
+        if (snapshot_read == nullptr) {
+            return false;
+        }
+
+        uint8_t *buffer = (uint8_t*)MemoryManager::poolAlloc(APP_SNAPSHOT_MAX, MEM_KERNEL);
+        if (buffer == nullptr) {
+            return false;
+        }
+
+        int32_t length = snapshot_read(instance.app->getName(), buffer, APP_SNAPSHOT_MAX);
+        bool restored = length > 0 && instance.app->restoreSnapshot(buffer, (uint16_t)length);
+        MemoryManager::poolFree(buffer);
+
+        if (!restored) {
+            // Fall back to a cold launch
+            Serial.printf("[KERNEL] Snapshot restore failed: %s\n", instance.app->getName());
+            return false;
+        }
+    }
+
+    instance.state = APP_STATE_RUNNING;
+    instance.app->setState(APP_STATE_RUNNING);
+    instance.app->onResume();
+    postAppEvent(EVENT_APP_RESUME, app_id);
     return true;
 }
 
@@ -247,20 +885,97 @@ bool Kernel::closeApp(uint8_t app_id) {
     }
 
     apps[app_id].app->onClose();
+    apps[app_id].app->setState(APP_STATE_INACTIVE);
     apps[app_id].state = APP_STATE_INACTIVE;
+    apps[app_id].trimmed = false;
+
+    postAppEvent(EVENT_APP_CLOSE, app_id);
 
-    Event close_event = {
-        .type = EVENT_APP_CLOSE,
+    apps[app_id].app = nullptr;
+    requestRender();
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Post an app lifecycle event (data1 = app id, data3 = App*)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::postAppEvent(EventType type, uint8_t app_id) {
+    Event event = {
+        .type = type,
         .priority = PRIORITY_NORMAL,
         .timestamp = millis(),
         .data1 = app_id,
         .data2 = 0,
-        .ptr = apps[app_id].app
+        .data3 = apps[app_id].app
     };
-    postEvent(close_event);
+    postEvent(event);
+}
 
-    apps[app_id].app = nullptr;
-    return true;
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// BACK not handled by the app (subscriber)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::onAppBack(const Event &event) {
+    (void)event;
+
+    if (active_app_id != HOME_APP_ID) {
+        switchToApp(HOME_APP_ID);
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Snapshot storage for trimmed apps
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::setSnapshotStore(AppSnapshotWriteFn write, AppSnapshotReadFn read) {
+    snapshot_write = write;
+    snapshot_read = read;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Ask the loop to snapshot suspended apps (memory pressure)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::requestAppTrim() {
+    trim_requested = true;
+    signalTask(PHASE_APPS);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Snapshot suspended apps to storage and let them drop their state
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::trimSuspendedApps() {
+    if (snapshot_write == nullptr) {
+        return;
+    }
+
+    uint8_t *buffer = nullptr;
+    for (uint8_t i = 0; i < MAX_APPS; i++) {
+        AppInstance &instance = apps[i];
+        if (instance.app == nullptr || instance.state != APP_STATE_SUSPENDED || instance.trimmed) {
+            continue;
+        }
+
+        if (buffer == nullptr) {
+            buffer = (uint8_t*)MemoryManager::poolAlloc(APP_SNAPSHOT_MAX, MEM_KERNEL);
+            if (buffer == nullptr) {
+                return;
+            }
+        }
+
+        // Apps without a snapshot format just stay in RAM
+        uint16_t length = instance.app->saveSnapshot(buffer, APP_SNAPSHOT_MAX);
+        if (length == 0 || length > APP_SNAPSHOT_MAX) {
+            continue;
+        }
+        if (!snapshot_write(instance.app->getName(), buffer, length)) {
+            Serial.printf("[KERNEL] Snapshot write failed: %s\n", instance.app->getName());
+            continue;
+        }
+
+        instance.app->onTrim();
+        instance.trimmed = true;
+        Serial.printf("[KERNEL] Trimmed %s (%u byte snapshot)\n", instance.app->getName(), length);
+    }
+
+    MemoryManager::poolFree(buffer);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -277,25 +992,116 @@ uint8_t Kernel::getActiveAppID() {
     return active_app_id;
 }
 
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Duration of the last launch / resume
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t Kernel::getLastSwitchTime() {
+    return last_switch_us;
+}
+
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Post event to queue
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool Kernel::postEvent(const Event &event) {
-    return EventQueue::enqueue(event);
+    if (!EventQueue::postEvent(event)) {
+        return false;
+    }
+
+    // Posted from another runner: this also ends the loop's wait
+    signalTask(PHASE_EVENTS);
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Post event from interrupt context
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool IRAM_ATTR Kernel::postEventFromISR(const Event &event) {
+    if (!EventQueue::postEventFromISR(event)) {
+        return false;
+    }
+    notifyLoopFromISR(PHASE_EVENTS);
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Subscribe a handler to one event type
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::subscribe(EventType type, EventHandler handler) {
+    if (handler == nullptr) {
+        return false;
+    }
+
+    // Already subscribed?
+    for (uint8_t i = subscriber_head[type]; i != NO_SUBSCRIBER; i = subscribers[i].next) {
+        if (subscribers[i].handler == handler) {
+            return true;
+        }
+    }
+
+    if (subscriber_free == NO_SUBSCRIBER) {
+        Serial.printf("[KERNEL] Subscriber table full, event type %d\n", type);
+        return false;
+    }
+
+    // Append so handlers run in subscription order
+    uint8_t slot = subscriber_free;
+    subscriber_free = subscribers[slot].next;
+    subscribers[slot].handler = handler;
+    subscribers[slot].next = NO_SUBSCRIBER;
+
+    uint8_t *link = &subscriber_head[type];
+    while (*link != NO_SUBSCRIBER) {
+        link = &subscribers[*link].next;
+    }
+    *link = slot;
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Remove a handler from one event type
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::unsubscribe(EventType type, EventHandler handler) {
+    uint8_t *link = &subscriber_head[type];
+    while (*link != NO_SUBSCRIBER) {
+        uint8_t slot = *link;
+        if (subscribers[slot].handler == handler) {
+            *link = subscribers[slot].next;
+            subscribers[slot].handler = nullptr;
+            subscribers[slot].next = subscriber_free;
+            subscriber_free = slot;
+            return true;
+        }
+        link = &subscribers[slot].next;
+    }
+    return false;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Empty the subscriber table (init only)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::resetSubscribers() {
+    for (int i = 0; i < 256; i++) {
+        subscriber_head[i] = NO_SUBSCRIBER;
+    }
+    for (uint8_t i = 0; i < MAX_EVENT_SUBSCRIBERS; i++) {
+        subscribers[i].handler = nullptr;
+        subscribers[i].next = (i + 1 < MAX_EVENT_SUBSCRIBERS) ? i + 1 : NO_SUBSCRIBER;
+    }
+    subscriber_free = 0;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Process event from queue
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool Kernel::processEvent(Event &event) {
-    return EventQueue::dequeue(event);
+    return EventQueue::getEvent(event);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Get event queue size
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-uint8_t Kernel::getEventQueueSize() {
-    return EventQueue::getQueueSize();
+uint16_t Kernel::getEventQueueSize() {
+    return EventQueue::getEventCount();
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -328,45 +1134,169 @@ float Kernel::getLoopFrequency() {
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Handle button events
+// Add one sample to a phase's rolling window
+void Kernel::recordSample(uint8_t row, uint32_t elapsed_us) {
+    phase_samples[row][profile_head[row]] = elapsed_us;
+    profile_head[row] = (profile_head[row] + 1) % PROFILE_WINDOW;
+    if (profile_count[row] < PROFILE_WINDOW) {
+        profile_count[row]++;
+    }
+}
+
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-void Kernel::handleButtonEvents() {
-    for (int i = 0; i < 9; i++) {
-        ButtonEvent btn_event = ButtonDriver::getEvent((ButtonID)i);
+// Compute min/mean/p99/max over the filled part of a sample window
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::computeStats(uint8_t row, PhaseStats &stats) {
+    const uint32_t *samples = phase_samples[row];
+    uint16_t count = profile_count[row];
 
-        if (btn_event == BTN_NONE) continue;
+    stats.samples = count;
+    if (count == 0) {
+        stats.min_us = stats.mean_us = stats.p99_us = stats.max_us = 0;
+        return;
+    }
 
-        Event event = {
-            .type = (btn_event == BTN_SHORT_PRESS) ? EVENT_BUTTON_PRESS :
-                   (btn_event == BTN_LONG_PRESS) ? EVENT_BUTTON_LONG_PRESS :
-                   EVENT_BUTTON_RELEASE,
-            .priority = PRIORITY_HIGH,
-            .timestamp = millis(),
-            .data1 = i,  // Button ID
-            .data2 = 0,
-            .ptr = nullptr
-        };
+    // Insertion sort a copy (window is small and only sorted on query)
+    uint32_t sorted[PROFILE_WINDOW];
+    uint64_t sum = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        uint32_t v = samples[i];
+        sum += v;
+        int16_t j = i - 1;
+        while (j >= 0 && sorted[j] > v) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = v;
+    }
 
+    // Nearest-rank p99
+    uint16_t p99_rank = (count * 99 + 99) / 100;
+
+    stats.min_us = sorted[0];
+    stats.max_us = sorted[count - 1];
+    stats.mean_us = (uint32_t)(sum / count);
+    stats.p99_us = sorted[p99_rank - 1];
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get rolling statistics for one tick phase
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Kernel::getPhaseStats(uint8_t phase, PhaseStats &stats) {
+    if (phase >= PHASE_COUNT) {
+        return false;
+    }
+
+    computeStats(phase, stats);
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get rolling statistics for the whole tick
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::getFrameStats(PhaseStats &stats) {
+    computeStats(PHASE_COUNT, stats);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get phase name
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+const char* Kernel::getPhaseName(uint8_t phase) {
+    return phase < PHASE_COUNT ? phase_names[phase] : "unknown";
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Ticks that exceeded the 1/DISPLAY_FPS frame budget
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t Kernel::getFrameOverruns() {
+    return frame_overruns;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Frames skipped because the rendered content did not change
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t Kernel::getSkippedFrames() {
+    return frames_skipped;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Clear all profiler samples
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::resetPhaseStats() {
+    memset(profile_head, 0, sizeof(profile_head));
+    memset(profile_count, 0, sizeof(profile_count));
+    frame_overruns = 0;
+    frames_skipped = 0;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Input phase: scan buttons and turn presses into events
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::pollButtons() {
+    ButtonDriver::update();
+    handleButtonEvents();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Handle button events
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::handleButtonEvents() {
+    // Debounced events in press order, stamped with the edge time;
+    // the events phase later in this tick delivers them
+    Event event;
+    while (ButtonDriver::getNextEvent(event)) {
         postEvent(event);
+    }
+}
 
-        // Send to active app
-        if (apps[active_app_id].app != nullptr) {
-            apps[active_app_id].app->onEvent(event);
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Drain the event queue under the per-tick budget
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::dispatchEvents() {
+    uint32_t start = micros();
+    Event event;
+
+    while (EventQueue::peekEvent(event)) {
+        // Out of budget: finish next tick, but never hold back critical events
+        if (event.priority != PRIORITY_CRITICAL &&
+            micros() - start >= EVENT_DISPATCH_BUDGET_US) {
+            dispatch_deferrals++;
+            signalTask(PHASE_EVENTS);
+            return;
         }
+
+        EventQueue::getEvent(event);
+        dispatchEvent(event);
+        events_dispatched++;
     }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Handle power events
+// Deliver one event to its subscribers, then the active app
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-void Kernel::handlePowerEvents() {
-    static uint32_t last_check = 0;
+void Kernel::dispatchEvent(const Event &event) {
+    uint8_t i = subscriber_head[event.type];
+    while (i != NO_SUBSCRIBER) {
+        // Read next first so a handler may unsubscribe itself
+        uint8_t next = subscribers[i].next;
+        subscribers[i].handler(event);
+        i = next;
+    }
 
-    if ((millis() - last_check) < 1000) {  // Check every second
-        return;
+    // Redraw only if the app says the event changed its screen
+    if (apps[active_app_id].app != nullptr && apps[active_app_id].state == APP_STATE_RUNNING &&
+        apps[active_app_id].app->onEvent(event)) {
+        requestRender();
     }
-    last_check = millis();
 
+    // Everyone has seen it: drop the queue's payload reference
+    EventPayloads::releaseEvent(event);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Handle power events
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::handlePowerEvents() {
     // Check battery
     if (PowerManager::isCriticalBattery() && !PowerManager::isCharging()) {
         Event event = {
@@ -375,7 +1305,7 @@ void Kernel::handlePowerEvents() {
             .timestamp = millis(),
             .data1 = PowerManager::getBatteryPercentage(),
             .data2 = 0,
-            .ptr = nullptr
+            .data3 = nullptr
         };
         postEvent(event);
     }
@@ -386,12 +1316,12 @@ void Kernel::handlePowerEvents() {
     if (is_charging != was_charging) {
         was_charging = is_charging;
         Event event = {
-            .type = EVENT_POWER_CHARGING,
+            .type = is_charging ? EVENT_POWER_CHARGING_START : EVENT_POWER_CHARGING_STOP,
             .priority = PRIORITY_NORMAL,
             .timestamp = millis(),
-            .data1 = is_charging ? 1 : 0,
+            .data1 = 0,
             .data2 = 0,
-            .ptr = nullptr
+            .data3 = nullptr
         };
         postEvent(event);
     }
@@ -401,13 +1331,17 @@ void Kernel::handlePowerEvents() {
 // Update active app
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void Kernel::updateApps() {
-    // Update active app
-    if (apps[active_app_id].app != nullptr && apps[active_app_id].state == APP_STATE_RUNNING) {
-        apps[active_app_id].app->update();
+    // Memory pressure seen by the memory task (service runner)
+    if (trim_requested.exchange(false)) {
+        trimSuspendedApps();
     }
 
-    // Reset idle timer on activity
-    PowerManager::resetIdleTimer();
+    // Update active app
+    // Idle apps cost no render or flush; animating ones redraw per frame
+    if (apps[active_app_id].app != nullptr && apps[active_app_id].state == APP_STATE_RUNNING &&
+        apps[active_app_id].app->update()) {
+        requestRender();
+    }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -425,25 +1359,47 @@ void Kernel::renderDisplay() {
         apps[active_app_id].app->render();
     }
 
-    DisplayDriver::display();
+    // Flush runs right after this phase in the same tick
+    signalTask(PHASE_FLUSH);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Manage memory (check heap, warn if low)
+// Push the rendered frame to the panel
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-void Kernel::manageMemory() {
-    static uint32_t last_check = 0;
-
-    if ((millis() - last_check) < 10000) {  // Check every 10 seconds
+void Kernel::flushDisplay() {
+    if (!DisplayDriver::isInitialized()) {
         return;
     }
-    last_check = millis();
 
+    if (!DisplayDriver::display()) {
+        frames_skipped++;
+    } else if (BootTimeline::getFirstFrameTime() == 0) {
+        BootTimeline::markFirstFrame();     // No splash: the home app's frame is first
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Manage memory (check heap, warn if low)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::manageMemory() {
+    MemoryManager::sample();
     uint32_t free_heap = ESP.getFreeHeap();
 
     if (free_heap < FREE_HEAP_THRESHOLD) {
         Serial.printf("[KERNEL] !!! LOW MEMORY: %ld bytes free\n", free_heap);
     }
+
+    // Plenty free but no big block: allocations will start failing
+    uint8_t fragmentation = MemoryManager::getFragmentation();
+    if (fragmentation > HEAP_FRAG_WARN_PERCENT) {
+        Serial.printf("[KERNEL] !!! HEAP FRAGMENTED: %d%% (largest block %ld of %ld bytes)\n",
+            fragmentation, MemoryManager::getLargestFreeBlock(), free_heap);
+    }
+
+    // Under pressure, background apps give their state back
+    if (free_heap < FREE_HEAP_THRESHOLD || fragmentation > HEAP_FRAG_WARN_PERCENT) {
+        requestAppTrim();
+    }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -458,10 +1414,27 @@ void Kernel::printDebugInfo() {
     Serial.printf("â•‘ Tick Count: %ld\n", tick_count);
     Serial.printf("â•‘ Loop Time: %ld ms\n", last_loop_time);
     Serial.printf("â•‘ Loop Freq: %.1f Hz\n", getLoopFrequency());
-    Serial.printf("â•‘ Event Queue: %d/32\n", getEventQueueSize());
+    Serial.printf("â•‘ Event Queue: %d/%d\n", getEventQueueSize(), EventQueue::getQueueCapacity());
+    Serial.printf("â•‘ Events dispatched: %u (deferred %u ticks)\n", events_dispatched, dispatch_deferrals);
+    Serial.printf("â•‘ Frames Skipped: %lu/%lu\n", (unsigned long)frames_skipped, (unsigned long)tick_count);
+    for (uint8_t i = 0; i < DEVICE_COUNT; i++) {
+        Serial.printf("â•‘ Device %-8s %s", device_names[i], device_status_names[devices[i].status]);
+        if (devices[i].status != DEVICE_PRESENT) {
+            Serial.printf(" (%u failed, next try in %ld ms)", devices[i].failures,
+                (long)(devices[i].retry_ms - millis()));
+        }
+        Serial.println();
+    }
 
     if (apps[active_app_id].app != nullptr) {
         Serial.printf("â•‘ Active App: %s (ID %d)\n", apps[active_app_id].app->getName(), active_app_id);
+        Serial.printf("â•‘ Last Switch: %lu us (%s)\n", (unsigned long)last_switch_us, last_switch_warm ? "warm" : "cold");
+    }
+    for (uint8_t i = 0; i < MAX_APPS; i++) {
+        if (apps[i].app != nullptr && apps[i].state == APP_STATE_SUSPENDED) {
+            Serial.printf("â•‘ Suspended: %s (ID %d)%s\n", apps[i].app->getName(), i,
+                apps[i].trimmed ? " [snapshot]" : "");
+        }
     }
 
     Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
@@ -471,11 +1444,66 @@ void Kernel::printDebugInfo() {
 // Print memory information
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void Kernel::printMemoryInfo() {
-    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
-    Serial.println("â•‘  MEMORY INFO                      â•‘");
-    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
-    Serial.printf("â•‘ Free Heap: %ld bytes\n", ESP.getFreeHeap());
-    Serial.printf("â•‘ Min Free Heap: %ld bytes\n", ESP.getMinFreeHeap());
-    Serial.printf("â•‘ PSRAM Free: %ld bytes\n", ESP.getFreePsram());
-    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+    MemoryManager::printDebugInfo();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Print scheduler task table
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::printTaskInfo() {
+    uint32_t now = micros();
+
+    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
+    Serial.println("â•‘  KERNEL TASKS                     â•‘");
+    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
+    Serial.printf("â•‘ %-2s %-10s %-8s %10s %10s %s\n", "id", "name", "runner", "period_us", "due_in_us", "mode");
+
+    for (uint8_t i = 0; i < task_count; i++) {
+        const KernelTask &task = tasks[i];
+        int32_t due_in = (int32_t)(task.next_run_us - now);
+        Serial.printf("â•‘ %-2d %-10s %-8s %10lu %10ld %s\n", i, task.name,
+            multicore ? runner_names[task.runner] : runner_names[RUNNER_REALTIME],
+            (unsigned long)task.period_us, (long)(due_in > 0 ? due_in : 0),
+            task.on_demand ? (task.signaled ? "demand*" : "demand") : "periodic");
+    }
+
+    // Load per runner since startup
+    Serial.printf("â•‘ Runners: %s\n", multicore ? "multicore" : "all on loop()");
+    for (uint8_t r = 0; r < RUNNER_COUNT; r++) {
+        const RunnerStats &stats = runner_stats[r];
+        if (stats.loops == 0) continue;
+        uint32_t span = now - stats.start_us;
+        Serial.printf("â•‘ %-8s %8lu passes, busy %.1f%%\n", runner_names[r],
+            (unsigned long)stats.loops, span ? (float)stats.busy_us * 100.0f / span : 0.0f);
+    }
+
+    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Print per-phase timing table
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Kernel::printPhaseStats() {
+    PhaseStats stats;
+
+    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
+    Serial.println("â•‘  TICK PROFILE (us)                â•‘");
+    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
+    Serial.printf("â•‘ %-8s %7s %7s %7s %7s\n", "phase", "min", "mean", "p99", "max");
+
+    for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+        getPhaseStats(i, stats);
+        Serial.printf("â•‘ %-8s %7lu %7lu %7lu %7lu\n", getPhaseName(i),
+            (unsigned long)stats.min_us, (unsigned long)stats.mean_us,
+            (unsigned long)stats.p99_us, (unsigned long)stats.max_us);
+    }
+
+    getFrameStats(stats);
+    Serial.printf("â•‘ %-8s %7lu %7lu %7lu %7lu\n", "total",
+        (unsigned long)stats.min_us, (unsigned long)stats.mean_us,
+        (unsigned long)stats.p99_us, (unsigned long)stats.max_us);
+    Serial.printf("â•‘ Window: %d ticks, budget %lu us\n", stats.samples, FRAME_PERIOD_US);
+    Serial.printf("â•‘ Overruns: %lu\n", (unsigned long)frame_overruns);
+    Serial.printf("â•‘ Skipped frames: %lu\n", (unsigned long)frames_skipped);
+    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
 }
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <Arduino.h>
 #include "events.h"
+#include "../config/system_config.h"
 
 // ============================================================================
 // ionOS v1.0 - KERNEL (Core Event Loop & App Manager)
@@ -14,15 +15,108 @@ class App;  // Forward declaration
 enum AppState {
     APP_STATE_INACTIVE = 0,
     APP_STATE_RUNNING = 1,
-    APP_STATE_SUSPENDED = 2,
-    APP_STATE_PAUSED = 3
+    APP_STATE_SUSPENDED = 2,    // In the background, state kept
+    APP_STATE_PAUSED = 3,
+    APP_STATE_CLOSING = 4
+};
+
+// App snapshot storage (registered by StorageService). Without one,
+// suspended apps simply stay in RAM.
+typedef bool (*AppSnapshotWriteFn)(const char *app_name, const uint8_t *data, uint16_t length);
+typedef int32_t (*AppSnapshotReadFn)(const char *app_name, uint8_t *data, uint16_t capacity);
+
+// Tick phases (built-in scheduler tasks, in execution order)
+enum KernelPhase {
+    PHASE_BUTTONS = 0,
+    PHASE_POWER = 1,
+    PHASE_EVENTS = 2,   // EventQueue -> subscribers + active app
+    PHASE_APPS = 3,
+    PHASE_BATTERY = 4,
+    PHASE_RENDER = 5,   // clear + app render()
+    PHASE_FLUSH = 6,    // framebuffer -> SSD1306 over I2C
+    PHASE_MEMORY = 7,
+    PHASE_SERVICES = 8, // Tasks added with registerTask() (service runner)
+    PHASE_COUNT = 9
+};
+
+// Scheduler runners. With KERNEL_MULTICORE the service and stream runners
+// are pinned FreeRTOS tasks (pthreads on native) and talk to the real-time
+// runner only through the event queue; otherwise tick() runs everything.
+enum KernelRunner {
+    RUNNER_REALTIME = 0,    // Input, events, apps, render (loop() task, core 1)
+    RUNNER_SERVICE = 1,     // Power, battery, memory, time/log/storage (core 0)
+    RUNNER_STREAM = 2,      // Audio and network streaming (core 0)
+    RUNNER_COUNT = 3
+};
+
+// Boot devices. A failed init does not halt boot: the device is marked
+// absent (or degraded when a fallback covers for it) and re-initialized in
+// the background with exponential backoff.
+enum DeviceId {
+    DEVICE_DISPLAY = 0,
+    DEVICE_BUTTONS = 1,
+    DEVICE_BATTERY = 2,
+    DEVICE_RTC = 3,         // Degraded = millis() software clock
+    DEVICE_POWER = 4,
+    DEVICE_COUNT = 5
+};
+
+enum DeviceStatus {
+    DEVICE_ABSENT = 0,
+    DEVICE_DEGRADED = 1,
+    DEVICE_PRESENT = 2
+};
+
+struct DeviceState {
+    DeviceStatus status;
+    uint16_t failures;      // Failed inits since the device was last present
+    uint32_t retry_ms;      // Next attempt (millis)
+    uint32_t backoff_ms;    // Wait before the attempt after that
+};
+
+typedef void (*KernelTaskFn)();
+typedef void (*EventHandler)(const Event &event);
+
+// Subscriber table entry (per-EventType singly linked lists in a fixed pool)
+struct EventSubscriber {
+    EventHandler handler;
+    uint8_t next;           // Next subscriber index, or NO_SUBSCRIBER
+};
+
+// Deadline-scheduled kernel task
+struct KernelTask {
+    const char *name;
+    KernelTaskFn run;
+    std::atomic<uint32_t> period_us;    // Minimum spacing between runs (0 = none)
+    std::atomic<uint32_t> next_run_us;  // Deadline in micros() time (setTaskPeriod() from any runner)
+    bool on_demand;         // Only runs once signaled, then rate-limited by period
+    std::atomic<bool> signaled;  // Set from other runners and ISRs
+    uint8_t runner;         // KernelRunner that executes it
+};
+
+// Per-runner load counters (written by the runner only)
+struct RunnerStats {
+    uint32_t loops;         // Scheduler passes
+    uint32_t busy_us;       // Time spent in task bodies
+    uint32_t start_us;      // When the runner started
+};
+
+// Rolling timing statistics over the last PROFILE_WINDOW ticks (microseconds)
+struct PhaseStats {
+    uint32_t min_us;
+    uint32_t mean_us;
+    uint32_t p99_us;
+    uint32_t max_us;
+    uint16_t samples;
 };
 
 struct AppInstance {
     App *app;
     AppState state;
     uint32_t launch_time;
+    uint32_t suspend_time;
     uint8_t app_id;
+    bool trimmed;           // State handed to a snapshot, restore before resuming
 };
 
 class Kernel {
@@ -37,16 +131,38 @@ public:
     static void tick();
     static void run();  // Blocking main loop
 
-    // App management
+    // Deadline scheduler
+    static int8_t registerTask(const char *name, KernelTaskFn fn, uint32_t period_us, bool on_demand = false,
+                               KernelRunner runner = RUNNER_SERVICE);
+    static bool setTaskPeriod(uint8_t task_id, uint32_t period_us);
+    static void signalTask(uint8_t task_id);  // Any runner; wakes the task's runner
+    static void requestRender();
+    static uint32_t getTimeToNextDeadline();   // Microseconds, 0 if a task is due (loop runner)
+    static void waitForNextDeadline();
+    static bool isMulticore();                 // Runner tasks spawned
+    static void IRAM_ATTR wakeFromISR();      // Run the buttons task and end the wait early
+
+    // App management (launching a suspended app resumes it)
     static bool launchApp(App *app, uint8_t app_id);
+    static bool switchToApp(uint8_t app_id);   // Bring an app in the table to the front
     static bool closeApp(uint8_t app_id);
     static App* getActiveApp();
     static uint8_t getActiveAppID();
+    static void setSnapshotStore(AppSnapshotWriteFn write, AppSnapshotReadFn read);
+    static void requestAppTrim();              // Any runner; snapshots suspended apps on the loop
+    static uint32_t getLastSwitchTime();       // Microseconds
+
+    // Devices (status changes post EVENT_SYSTEM_DEVICE)
+    static DeviceStatus getDeviceStatus(uint8_t device);
+    static const char* getDeviceName(uint8_t device);
 
     // Event handling
-    static bool postEvent(const Event &event);
-    static bool processEvent(Event &event);
-    static uint8_t getEventQueueSize();
+    static bool subscribe(EventType type, EventHandler handler);
+    static bool unsubscribe(EventType type, EventHandler handler);
+    static bool postEvent(const Event &event);            // Any task
+    static bool IRAM_ATTR postEventFromISR(const Event &event);
+    static bool processEvent(Event &event);               // Caller releases its payload
+    static uint16_t getEventQueueSize();
 
     // System stats
     static uint32_t getTickCount();
@@ -54,27 +170,93 @@ public:
     static uint32_t getLoopTime();
     static float getLoopFrequency();
 
+    // Profiling (per-phase tick timing)
+    static bool getPhaseStats(uint8_t phase, PhaseStats &stats);
+    static void getFrameStats(PhaseStats &stats);
+    static const char* getPhaseName(uint8_t phase);
+    static uint32_t getFrameOverruns();
+    static uint32_t getSkippedFrames();
+    static void resetPhaseStats();
+
     // Debug
     static void printDebugInfo();
     static void printMemoryInfo();
+    static void printPhaseStats();
+    static void printTaskInfo();
 
 private:
-    static bool running;
+    static std::atomic<bool> running;
     static bool initialized;
+    static bool multicore;
 
-    static const uint8_t MAX_APPS = 10;
     static AppInstance apps[MAX_APPS];
     static uint8_t active_app_id;
+    static AppSnapshotWriteFn snapshot_write;
+    static AppSnapshotReadFn snapshot_read;
+    static std::atomic<bool> trim_requested;
+    static uint32_t last_switch_us;
+    static bool last_switch_warm;
     static uint32_t tick_count;
     static uint32_t last_loop_time;
+    static DeviceState devices[DEVICE_COUNT];
     static uint32_t loop_start_time;
 
+    // Scheduler: built-in phases first (task id == KernelPhase), then services
+    static KernelTask tasks[MAX_KERNEL_TASKS];
+    static uint8_t task_count;
+    static RunnerStats runner_stats[RUNNER_COUNT];
+#ifndef IONOS_NATIVE
+    static TaskHandle_t runner_tasks[RUNNER_COUNT];  // [RUNNER_REALTIME] = loop() task
+#endif
+
+    // Profiler: one sample per phase run, last row is the whole tick
+    static const uint16_t PROFILE_WINDOW = 128;
+    static uint32_t phase_samples[PHASE_COUNT + 1][PROFILE_WINDOW];
+    static uint16_t profile_head[PHASE_COUNT + 1];
+    static uint16_t profile_count[PHASE_COUNT + 1];
+    static uint32_t frame_overruns;
+    static uint32_t frames_skipped;     // Unchanged frames not sent to the panel
+
+    // Event dispatch
+    static const uint8_t NO_SUBSCRIBER = 0xFF;
+    static EventSubscriber subscribers[MAX_EVENT_SUBSCRIBERS];
+    static uint8_t subscriber_head[256];   // Indexed by EventType
+    static uint8_t subscriber_free;        // Free list head
+    static uint32_t events_dispatched;
+    static uint32_t dispatch_deferrals;    // Ticks that ran out of dispatch budget
+
     // Internal methods
+    static void pollButtons();
     static void handleButtonEvents();
+    static void dispatchEvents();
+    static void dispatchEvent(const Event &event);
+    static void resetSubscribers();
     static void handlePowerEvents();
     static void updateApps();
+    static bool resumeApp(uint8_t app_id);
+    static void trimSuspendedApps();
+    static void postAppEvent(EventType type, uint8_t app_id);
+    static void onAppBack(const Event &event);
+    static void showSplash();
+    static bool bootDevice(uint8_t device);
+    static void setDeviceStatus(uint8_t device, bool ok);
+    static void retryDevices();
     static void renderDisplay();
+    static void flushDisplay();
     static void manageMemory();
+    static void IRAM_ATTR notifyLoopFromISR(uint8_t task_id);
+    static void addBuiltinTask(const char *name, KernelTaskFn fn, uint32_t period_us, bool on_demand,
+                               KernelRunner runner);
+    static bool isTaskDue(const KernelTask &task, uint32_t now);
+    static uint32_t runTasks(uint8_t runner);
+    static uint32_t getTimeToNextDeadline(uint8_t runner);
+    static bool startRunners();
+    static void stopRunners();
+    static void runnerMain(void *arg);
+    static void waitRunner(uint8_t runner, uint32_t wait_us);
+    static void wakeRunner(uint8_t runner);
+    static void recordSample(uint8_t row, uint32_t elapsed_us);
+    static void computeStats(uint8_t row, PhaseStats &stats);
 };
 
 #endif // IONOS_KERNEL_H
@@ -0,0 +1,294 @@
+#include "memory.h"
+#include <Arduino.h>
+#include <string.h>
+
+// ============================================================================
+// ionOS v1.0 - MEMORY MANAGER IMPLEMENTATION
+// ============================================================================
+
+// Static member initialization
+alignas(8) uint8_t MemoryManager::arena[MEM_ARENA_SIZE];
+size_t MemoryManager::arena_used = 0;
+bool MemoryManager::sealed = false;
+MemPool MemoryManager::pools[MemoryManager::POOL_CLASSES];
+uint32_t MemoryManager::subsystem_bytes[MEM_SUBSYSTEM_COUNT];
+uint32_t MemoryManager::subsystem_peak[MEM_SUBSYSTEM_COUNT];
+uint32_t MemoryManager::failed_allocs = 0;
+HeapSample MemoryManager::history[MEM_HISTORY_SAMPLES];
+uint8_t MemoryManager::history_count = 0;
+uint8_t MemoryManager::history_next = 0;
+uint32_t MemoryManager::min_largest_block = 0;
+
+static const char *subsystem_names[MEM_SUBSYSTEM_COUNT] = {
+    "kernel", "drivers", "services", "apps", "ui"
+};
+
+// Pool size classes (ascending) and their block counts
+static const uint16_t pool_sizes[] = { 32, 64, 128, 256, 512 };
+static const uint16_t pool_blocks[] = {
+    MEM_POOL_32_BLOCKS, MEM_POOL_64_BLOCKS, MEM_POOL_128_BLOCKS,
+    MEM_POOL_256_BLOCKS, MEM_POOL_512_BLOCKS
+};
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Initialize the arena and carve the block pools out of it
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool MemoryManager::init() {
+    arena_used = 0;
+    sealed = false;
+    failed_allocs = 0;
+    history_count = 0;
+    history_next = 0;
+    min_largest_block = ESP.getMaxAllocHeap();
+    memset(subsystem_bytes, 0, sizeof(subsystem_bytes));
+    memset(subsystem_peak, 0, sizeof(subsystem_peak));
+
+    for (uint8_t c = 0; c < POOL_CLASSES; c++) {
+        MemPool &pool = pools[c];
+        pool.block_size = pool_sizes[c];
+        pool.block_count = pool_blocks[c];
+        pool.in_use = 0;
+        pool.peak = 0;
+        pool.base = (uint8_t*)carve((size_t)pool.block_size * pool.block_count, 8);
+        pool.owners = (uint8_t*)carve(pool.block_count, 1);
+        pool.free_list = nullptr;
+
+        if (pool.base == nullptr || pool.owners == nullptr) {
+            Serial.println("[MEMORY] Arena too small for block pools");
+            return false;
+        }
+
+        // Thread the free list back to front so block 0 is handed out first
+        for (int i = pool.block_count - 1; i >= 0; i--) {
+            void *blk = pool.base + (size_t)i * pool.block_size;
+            *(void**)blk = pool.free_list;
+            pool.free_list = blk;
+        }
+    }
+
+    Serial.printf("[MEMORY] Arena %d bytes, %d bytes in block pools\n", MEM_ARENA_SIZE, (int)arena_used);
+    return true;
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Take aligned bytes off the arena (no accounting)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void* MemoryManager::carve(size_t size, size_t align) {
+    size_t start = (arena_used + align - 1) & ~(align - 1);
+    if (start + size > MEM_ARENA_SIZE) {
+        return nullptr;
+    }
+    arena_used = start + size;
+    return &arena[start];
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Allocate a boot-lifetime object from the arena
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void* MemoryManager::allocBoot(size_t size, size_t align, MemSubsystem owner) {
+    if (sealed) {
+        failed_allocs++;
+        Serial.printf("[MEMORY] Arena sealed, refusing %d bytes for %s\n", (int)size, subsystem_names[owner]);
+        return nullptr;
+    }
+
+    void *mem = carve(size, align);
+    if (mem == nullptr) {
+        failed_allocs++;
+        Serial.printf("[MEMORY] Arena exhausted, refusing %d bytes for %s\n", (int)size, subsystem_names[owner]);
+        return nullptr;
+    }
+
+    charge(owner, size);
+    return mem;
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Seal the arena (end of boot)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void MemoryManager::seal() {
+    sealed = true;
+    Serial.printf("[MEMORY] Arena sealed at %d/%d bytes\n", (int)arena_used, MEM_ARENA_SIZE);
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Allocate a block from the smallest pool class that fits
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void* MemoryManager::poolAlloc(size_t size, MemSubsystem owner) {
+    for (uint8_t c = 0; c < POOL_CLASSES; c++) {
+        MemPool &pool = pools[c];
+        if (size > pool.block_size || pool.free_list == nullptr) {
+            continue;  // Too small or exhausted: try the next class up
+        }
+
+        void *blk = pool.free_list;
+        pool.free_list = *(void**)blk;
+        pool.owners[((uint8_t*)blk - pool.base) / pool.block_size] = owner;
+        pool.in_use++;
+        if (pool.in_use > pool.peak) {
+            pool.peak = pool.in_use;
+        }
+
+        charge(owner, pool.block_size);
+        return blk;
+    }
+
+    failed_allocs++;
+    Serial.printf("[MEMORY] No pool block for %d bytes (%s)\n", (int)size, subsystem_names[owner]);
+    return nullptr;
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Return a block to its pool
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void MemoryManager::poolFree(void *ptr) {
+    if (ptr == nullptr) return;
+
+    MemPool *pool = findPool(ptr);
+    if (pool == nullptr) {
+        Serial.println("[MEMORY] poolFree() of a pointer outside the pools");
+        return;
+    }
+
+    uint8_t owner = pool->owners[((uint8_t*)ptr - pool->base) / pool->block_size];
+    charge((MemSubsystem)owner, -(int32_t)pool->block_size);
+
+    *(void**)ptr = pool->free_list;
+    pool->free_list = ptr;
+    pool->in_use--;
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Find the pool a block belongs to
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+MemPool* MemoryManager::findPool(void *ptr) {
+    uint8_t *p = (uint8_t*)ptr;
+    for (uint8_t c = 0; c < POOL_CLASSES; c++) {
+        MemPool &pool = pools[c];
+        uint8_t *end = pool.base + (size_t)pool.block_size * pool.block_count;
+        if (p >= pool.base && p < end && (p - pool.base) % pool.block_size == 0) {
+            return &pool;
+        }
+    }
+    return nullptr;
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Update per-subsystem accounting
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void MemoryManager::charge(MemSubsystem owner, int32_t bytes) {
+    if (owner >= MEM_SUBSYSTEM_COUNT) return;
+    subsystem_bytes[owner] += bytes;
+    if (subsystem_bytes[owner] > subsystem_peak[owner]) {
+        subsystem_peak[owner] = subsystem_bytes[owner];
+    }
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Record a heap sample (memory check task)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void MemoryManager::sample() {
+    HeapSample &entry = history[history_next];
+    entry.time_ms = millis();
+    entry.free_bytes = ESP.getFreeHeap();
+    entry.largest_block = getLargestFreeBlock();
+
+    if (entry.largest_block < min_largest_block) {
+        min_largest_block = entry.largest_block;
+    }
+
+    history_next = (history_next + 1) % MEM_HISTORY_SAMPLES;
+    if (history_count < MEM_HISTORY_SAMPLES) {
+        history_count++;
+    }
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get the largest block the heap can hand out
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t MemoryManager::getLargestFreeBlock() {
+    return ESP.getMaxAllocHeap();
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get heap fragmentation (share of free memory not in the largest block)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint8_t MemoryManager::getFragmentation() {
+    uint32_t free_bytes = ESP.getFreeHeap();
+    if (free_bytes == 0) return 0;
+
+    uint32_t largest = getLargestFreeBlock();
+    if (largest >= free_bytes) return 0;
+    return 100 - (uint8_t)((uint64_t)largest * 100 / free_bytes);
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get bytes currently charged to a subsystem
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t MemoryManager::getSubsystemBytes(MemSubsystem owner) {
+    return (owner < MEM_SUBSYSTEM_COUNT) ? subsystem_bytes[owner] : 0;
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get the most bytes ever charged to a subsystem
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint32_t MemoryManager::getSubsystemPeak(MemSubsystem owner) {
+    return (owner < MEM_SUBSYSTEM_COUNT) ? subsystem_peak[owner] : 0;
+}
+
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Print memory telemetry
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void MemoryManager::printDebugInfo() {
+    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
+    Serial.println("â•‘  MEMORY INFO                      â•‘");
+    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
+
+    uint32_t heap_size = ESP.getHeapSize();
+    uint32_t min_free = ESP.getMinFreeHeap();
+    Serial.printf("â•‘ Free Heap: %lu bytes\n", (unsigned long)ESP.getFreeHeap());
+    Serial.printf("â•‘ Min Free Heap: %lu bytes (high-water %lu used)\n",
+        (unsigned long)min_free, (unsigned long)(heap_size - min_free));
+    Serial.printf("â•‘ Largest Block: %lu bytes (lowest %lu)\n",
+        (unsigned long)getLargestFreeBlock(), (unsigned long)min_largest_block);
+    Serial.printf("â•‘ Fragmentation: %d%%\n", getFragmentation());
+    Serial.printf("â•‘ PSRAM Free: %lu bytes\n", (unsigned long)ESP.getFreePsram());
+    Serial.printf("â•‘ Arena: %d/%d bytes%s\n", (int)arena_used, MEM_ARENA_SIZE, sealed ? " (sealed)" : "");
+
+    for (uint8_t c = 0; c < POOL_CLASSES; c++) {
+        const MemPool &pool = pools[c];
+        Serial.printf("â•‘ Pool %3d B: %2d/%-2d in use, peak %d\n",
+            pool.block_size, pool.in_use, pool.block_count, pool.peak);
+    }
+
+    for (uint8_t i = 0; i < MEM_SUBSYSTEM_COUNT; i++) {
+        Serial.printf("â•‘ %-8s %6lu bytes (peak %lu)\n",
+            subsystem_names[i], (unsigned long)subsystem_bytes[i], (unsigned long)subsystem_peak[i]);
+    }
+    Serial.printf("â•‘ Failed allocations: %lu\n", (unsigned long)failed_allocs);
+
+    // Oldest sample first
+    if (history_count > 0) {
+        Serial.println("â•‘ History (s: free/largest KB):");
+        uint8_t first = (history_next + MEM_HISTORY_SAMPLES - history_count) % MEM_HISTORY_SAMPLES;
+        for (uint8_t n = 0; n < history_count; n++) {
+            const HeapSample &entry = history[(first + n) % MEM_HISTORY_SAMPLES];
+            Serial.printf("â•‘   %6lu: %lu/%lu\n", (unsigned long)(entry.time_ms / 1000),
+                (unsigned long)(entry.free_bytes / 1024), (unsigned long)(entry.largest_block / 1024));
+        }
+    }
+    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+}
@@ -0,0 +1,115 @@
+#ifndef IONOS_MEMORY_H
+#define IONOS_MEMORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <utility>
+#include "../config/system_config.h"
+
+// ============================================================================
+// ionOS v1.0 - MEMORY MANAGER
+// Static boot arena and fixed-size block pools, so long-running units never
+// fragment the heap, plus heap telemetry (largest free block, fragmentation,
+// per-subsystem bytes, high-water marks).
+//
+// Boot-lifetime objects (drivers, kernel structures) come from the arena
+// with create() and are never freed; the arena is sealed once the kernel
+// starts. Objects that come and go (app state, buffers) use poolCreate() /
+// poolDestroy() or poolAlloc() / poolFree(). Call from the kernel loop or
+// during boot only.
+// ============================================================================
+
+// Who an allocation is charged to
+enum MemSubsystem {
+    MEM_KERNEL = 0,
+    MEM_DRIVERS = 1,
+    MEM_SERVICES = 2,
+    MEM_APPS = 3,
+    MEM_UI = 4,
+    MEM_SUBSYSTEM_COUNT = 5
+};
+
+// One fixed-size block pool
+struct MemPool {
+    uint16_t block_size;
+    uint16_t block_count;
+    uint16_t in_use;
+    uint16_t peak;
+    uint8_t *base;          // Carved from the arena
+    void *free_list;        // Free blocks link through their first word
+    uint8_t *owners;        // Subsystem per block (for accounting on free)
+};
+
+// Heap sample taken by each memory check
+struct HeapSample {
+    uint32_t time_ms;
+    uint32_t free_bytes;
+    uint32_t largest_block;
+};
+
+class MemoryManager {
+public:
+    static bool init();
+
+    // Boot arena (never freed; fails once sealed)
+    static void* allocBoot(size_t size, size_t align, MemSubsystem owner);
+    static void seal();
+    static bool isSealed() { return sealed; }
+
+    template <typename T, typename... Args>
+    static T* create(MemSubsystem owner, Args&&... args) {
+        void *mem = allocBoot(sizeof(T), alignof(T), owner);
+        return mem ? new (mem) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // Block pools (smallest class that fits; nullptr when exhausted)
+    static void* poolAlloc(size_t size, MemSubsystem owner);
+    static void poolFree(void *ptr);
+
+    template <typename T, typename... Args>
+    static T* poolCreate(MemSubsystem owner, Args&&... args) {
+        void *mem = poolAlloc(sizeof(T), owner);
+        return mem ? new (mem) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    template <typename T>
+    static void poolDestroy(T *object) {
+        if (object == nullptr) return;
+        object->~T();
+        poolFree(object);
+    }
+
+    // Telemetry
+    static void sample();                   // Called by the kernel memory task
+    static uint32_t getLargestFreeBlock();
+    static uint8_t getFragmentation();      // 0-100 %, 100 - largest/free
+    static uint32_t getSubsystemBytes(MemSubsystem owner);
+    static uint32_t getSubsystemPeak(MemSubsystem owner);
+    static uint32_t getFailedCount() { return failed_allocs; }
+    static void printDebugInfo();
+
+private:
+    static const uint8_t POOL_CLASSES = 5;
+
+    alignas(8) static uint8_t arena[MEM_ARENA_SIZE];
+    static size_t arena_used;
+    static bool sealed;
+
+    static MemPool pools[POOL_CLASSES];
+
+    static uint32_t subsystem_bytes[MEM_SUBSYSTEM_COUNT];
+    static uint32_t subsystem_peak[MEM_SUBSYSTEM_COUNT];
+    static uint32_t failed_allocs;
+
+    static HeapSample history[MEM_HISTORY_SAMPLES];
+    static uint8_t history_count;
+    static uint8_t history_next;
+    static uint32_t min_largest_block;
+
+    static void* carve(size_t size, size_t align);
+    static void charge(MemSubsystem owner, int32_t bytes);
+    static MemPool* findPool(void *ptr);
+};
+
+#endif // IONOS_MEMORY_H
@@ -0,0 +1,125 @@
+#ifndef IONOS_MPSC_RING_H
+#define IONOS_MPSC_RING_H
+
+#include <stdint.h>
+#include <atomic>
+#include <Arduino.h>
+
+// ============================================================================
+// ionOS v1.0 - MPSC RING BUFFER
+// Lock-free multi-producer / single-consumer queue. Any task on either core,
+// or an ISR, may push(); one consumer pops. Each slot carries a sequence
+// number, so a producer claims a slot with one CAS on head, fills it, and
+// publishes it; the consumer never sees a half-written item. A full ring
+// rejects the push instead of waiting.
+//
+// Used by the event queue (one ring per priority level) and LogService.
+// ============================================================================
+
+template <typename T, uint32_t SIZE>
+class MpscRing {
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "MpscRing size must be a power of two");
+
+public:
+    MpscRing() {
+        reset(SIZE);
+    }
+
+    // Empty the ring and use the first `slots` cells (rounded down to a
+    // power of two, at most SIZE). Not safe against concurrent push/pop.
+    void reset(uint32_t slots) {
+        uint32_t count = 2;
+        while (count * 2 <= slots && count * 2 <= SIZE) {
+            count *= 2;
+        }
+        mask = count - 1;
+        for (uint32_t i = 0; i < SIZE; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        dropped.store(0, std::memory_order_release);
+    }
+
+    // Producer side (any task or ISR). An ISR that interrupts a producer
+    // between claim and publish only delays the consumer until that
+    // producer resumes; push() itself never waits on another producer.
+    bool IRAM_ATTR push(const T &item) {
+        uint32_t pos = head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = cells[pos & mask];
+            int32_t diff = (int32_t)(cell.sequence.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed,
+                                               std::memory_order_relaxed)) {
+                    cell.item = item;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // Lost the race; pos now holds the current head
+            } else if (diff < 0) {
+                // The consumer has not freed this slot yet
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer side: true when the oldest item is published
+    bool ready() const {
+        uint32_t pos = tail.load(std::memory_order_relaxed);
+        return cells[pos & mask].sequence.load(std::memory_order_acquire) == pos + 1;
+    }
+
+    // Consumer side: the item `index` places behind the oldest; false past
+    // the last published item (or one still being written)
+    bool peek(T &item, uint32_t index = 0) const {
+        uint32_t pos = tail.load(std::memory_order_relaxed) + index;
+        const Cell &cell = cells[pos & mask];
+        if (index > mask || cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        item = cell.item;
+        return true;
+    }
+
+    bool pop(T &item) {
+        uint32_t pos = tail.load(std::memory_order_relaxed);
+        Cell &cell = cells[pos & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        item = cell.item;
+        // Hand the slot back to producers one lap ahead
+        cell.sequence.store(pos + mask + 1, std::memory_order_release);
+        tail.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Claimed slots, including ones still being written (approximate while
+    // producers are active)
+    uint32_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    bool isEmpty() const { return size() == 0; }
+    uint32_t capacity() const { return mask + 1; }
+
+    // Items rejected because the ring was full (since the last reset)
+    uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell {
+        std::atomic<uint32_t> sequence;     // == position: free, == position + 1: ready
+        T item;
+    };
+
+    Cell cells[SIZE];
+    uint32_t mask;                          // capacity() - 1
+    std::atomic<uint32_t> head{0};          // Next slot to claim (producers)
+    std::atomic<uint32_t> tail{0};          // Next slot to read (consumer only)
+    std::atomic<uint32_t> dropped{0};
+};
+
+#endif // IONOS_MPSC_RING_H
@@ -1,4 +1,5 @@
 #include "power.h"
+#include "kernel.h"
 #include "../config/system_config.h"
 #include "../config/pinmap.h"
 #include "../drivers/battery_driver.h"
@@ -9,9 +10,10 @@
 
 // Static member initialization
 PowerMode PowerManager::current_mode = POWER_MODE_ACTIVE;
-uint32_t PowerManager::last_activity_time = 0;
+std::atomic<uint32_t> PowerManager::last_activity_time(0);
 uint32_t PowerManager::startup_time = 0;
 uint8_t PowerManager::wake_sources_enabled = 0;
+std::atomic<uint32_t> PowerManager::sleep_timeout_ms(SLEEP_TIMEOUT_MS);
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Initialize power manager
@@ -23,7 +25,13 @@ bool PowerManager::init() {
     // Enable button wake sources by default
     enableWakeSource(WAKE_GPIO);
     enableWakeSource(WAKE_TIMER);
-    
+
+    // Any button activity resets the idle timer
+    Kernel::subscribe(EVENT_BUTTON_PRESS, onInputActivity);
+    Kernel::subscribe(EVENT_BUTTON_RELEASE, onInputActivity);
+    Kernel::subscribe(EVENT_BUTTON_LONG_PRESS, onInputActivity);
+    Kernel::subscribe(EVENT_POWER_LOW_BATTERY, onLowBattery);
+
     Serial.println("[POWER] Power manager initialized");
     return true;
 }
@@ -121,6 +129,16 @@ void PowerManager::deepSleep(uint32_t ms) {
 void PowerManager::wake() {
     current_mode = POWER_MODE_ACTIVE;
     resetIdleTimer();
+
+    Event event = {
+        .type = EVENT_POWER_WAKE,
+        .priority = PRIORITY_HIGH,
+        .timestamp = millis(),
+        .data1 = 0,
+        .data2 = 0,
+        .data3 = nullptr
+    };
+    Kernel::postEvent(event);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -132,7 +150,7 @@ void PowerManager::enableWakeSource(WakeSource source) {
     switch (source) {
         case WAKE_GPIO:
             // Enable GPIO wake on button pins
-            esp_sleep_enable_ext0_wakeup((gpio_num_t)BTN_CENTER, 0);
+            esp_sleep_enable_ext0_wakeup((gpio_num_t)BTN_SELECT, 0);
             Serial.println("[POWER] GPIO wake source enabled");
             break;
 
@@ -189,7 +207,9 @@ uint32_t PowerManager::getUptimeMs() {
 // Get idle time in milliseconds
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 uint32_t PowerManager::getIdleTimeMs() {
-    return (millis() - last_activity_time);
+    // Timestamp first: one stored after millis() was sampled would wrap
+    uint32_t last_activity = last_activity_time;
+    return (millis() - last_activity);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -199,6 +219,17 @@ void PowerManager::resetIdleTimer() {
     last_activity_time = millis();
 }
 
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Idle time before light sleep (user setting)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void PowerManager::setSleepTimeout(uint32_t ms) {
+    sleep_timeout_ms = ms;
+}
+
+uint32_t PowerManager::getSleepTimeout() {
+    return sleep_timeout_ms;
+}
+
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Update power state based on battery and activity
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -214,7 +245,7 @@ void PowerManager::updatePowerState() {
 
     if (idle_time > DEEP_SLEEP_TIMEOUT_MS && ENABLE_DEEP_SLEEP) {
         setMode(POWER_MODE_DEEP_SLEEP);
-    } else if (idle_time > SLEEP_TIMEOUT_MS && ENABLE_LIGHT_SLEEP) {
+    } else if (idle_time > sleep_timeout_ms && ENABLE_LIGHT_SLEEP) {
         setMode(POWER_MODE_LIGHT_SLEEP);
     } else {
         setMode(POWER_MODE_ACTIVE);
@@ -231,6 +262,22 @@ void PowerManager::handleLowBattery() {
     // For now, just log and continue
 }
 
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Button activity (subscriber)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void PowerManager::onInputActivity(const Event &event) {
+    (void)event;
+    resetIdleTimer();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Critical battery event (subscriber)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void PowerManager::onLowBattery(const Event &event) {
+    (void)event;
+    handleLowBattery();
+}
+
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Print debug information
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
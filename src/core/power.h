@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 #include <Arduino.h>
+#include <atomic>
+#include "events.h"
 
 // ============================================================================
 // ionOS v1.0 - POWER MANAGEMENT
@@ -50,18 +52,25 @@ public:
     static uint32_t getUptimeMs();
     static uint32_t getIdleTimeMs();
     static void resetIdleTimer();
+    static void setSleepTimeout(uint32_t ms);   // Idle time before light sleep
+    static uint32_t getSleepTimeout();
 
     // Debug
     static void printDebugInfo();
 
 private:
     static PowerMode current_mode;
-    static uint32_t last_activity_time;
+    static std::atomic<uint32_t> last_activity_time;    // Input subscriber (kernel loop); read anywhere
     static uint32_t startup_time;
     static uint8_t wake_sources_enabled;
+    static std::atomic<uint32_t> sleep_timeout_ms;
 
     static void updatePowerState();
     static void handleLowBattery();
+
+    // Kernel event subscribers
+    static void onInputActivity(const Event &event);
+    static void onLowBattery(const Event &event);
 };
 
 #endif // IONOS_POWER_H
@@ -0,0 +1,63 @@
+#ifndef IONOS_SPSC_RING_H
+#define IONOS_SPSC_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+// ============================================================================
+// ionOS v1.0 - SPSC RING BUFFER
+// Lock-free single-producer / single-consumer queue for handing data from
+// an ISR to task context. One side only calls push(), the other only pop().
+// ============================================================================
+
+template <typename T, uint32_t SIZE>
+class SpscRing {
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+    // Producer side (ISR-safe: no locks, no allocation, bounded time).
+    // Forced inline so an IRAM ISR never calls into flash.
+    __attribute__((always_inline)) inline bool push(const T &item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= SIZE) {
+            dropped = dropped + 1;
+            return false;
+        }
+        items[h & (SIZE - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T &item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items[t & (SIZE - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: drop everything currently queued
+    void clear() {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    uint32_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    bool isEmpty() const { return size() == 0; }
+    uint32_t capacity() const { return SIZE; }
+
+    // Items rejected because the ring was full (monotonic)
+    uint32_t getDropped() const { return dropped; }
+
+private:
+    T items[SIZE];
+    std::atomic<uint32_t> head{0};  // Written by the producer only
+    std::atomic<uint32_t> tail{0};  // Written by the consumer only
+    volatile uint32_t dropped = 0;  // Written by the producer only
+};
+
+#endif // IONOS_SPSC_RING_H
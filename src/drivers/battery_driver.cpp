@@ -12,23 +12,47 @@ uint8_t BatteryDriver::percentage = 50;
 uint16_t BatteryDriver::min_voltage = BAT_MIN_MV;
 uint16_t BatteryDriver::max_voltage = BAT_MAX_MV;
 uint32_t BatteryDriver::last_sample_time = 0;
+uint32_t BatteryDriver::settle_start_us = 0;
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Initialize battery driver
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool BatteryDriver::init() {
+    beginInit();
+    return finishInit();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Configure the ADC; the divider needs time to charge the sample cap
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void BatteryDriver::beginInit() {
     // Configure ADC
-    pinMode(BAT_ADC_PIN, INPUT);
-    analogSetPinAttenuation(BAT_ADC_PIN, ADC_11db);  // Full scale ~3.3V
+    pinMode(BATTERY_ADC_PIN, INPUT);
+    analogSetPinAttenuation(BATTERY_ADC_PIN, ADC_11db);  // Full scale ~3.3V
     analogSetClockDiv(1);
 
     // Configure charger detect pin
-    pinMode(CHARGER_DETECT, INPUT_PULLDOWN);
+    pinMode(CHARGING_PIN, INPUT_PULLDOWN);
 
-    // Take initial reading
-    update();
-    
-    Serial.println("[BATTERY] Initialized battery driver");
+    // First conversion after configuring is unreliable; discard it
+    analogRead(BATTERY_ADC_PIN);
+    settle_start_us = micros();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Take the initial reading once the input has settled
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool BatteryDriver::finishInit() {
+    uint32_t settled_us = micros() - settle_start_us;
+    if (settled_us < BAT_ADC_SETTLE_US) {
+        delayMicroseconds(BAT_ADC_SETTLE_US - settled_us);
+    }
+
+    // Not rate-limited like update(): boot needs a real value
+    sample();
+    last_sample_time = millis();
+
+    Serial.printf("[BATTERY] Initialized battery driver (%d mV, %d%%)\n", voltage_mv, percentage);
     return true;
 }
 
@@ -44,7 +68,7 @@ void BatteryDriver::shutdown() {
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 uint16_t BatteryDriver::readRawVoltage() {
     // Read ADC value (0-4095 for 12-bit)
-    uint16_t adc_value = analogRead(BAT_ADC_PIN);
+    uint16_t adc_value = analogRead(BATTERY_ADC_PIN);
     
     // Convert to voltage: ADC_max = 3.3V, but battery voltage can be ~4.2V
     // Assuming voltage divider (e.g., 2:1) to step down to 0-3.3V range
@@ -68,6 +92,13 @@ void BatteryDriver::update() {
     }
     last_sample_time = now;
 
+    sample();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Average a few conversions into voltage and percentage
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void BatteryDriver::sample() {
     // Read voltage (average 5 samples for stability)
     uint32_t sum = 0;
     for (int i = 0; i < 5; i++) {
@@ -111,7 +142,7 @@ uint8_t BatteryDriver::getPercentage() {
 // Check if currently charging
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool BatteryDriver::isCharging() {
-    return digitalRead(CHARGER_DETECT) == HIGH;
+    return digitalRead(CHARGING_PIN) == HIGH;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
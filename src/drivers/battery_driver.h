@@ -11,8 +11,11 @@
 
 class BatteryDriver {
 public:
-    // Initialization
+    // Initialization. init() = beginInit() + finishInit(); boot calls the
+    // two halves apart so the ADC input settles while the display comes up.
     static bool init();
+    static void beginInit();            // Configure the ADC, start settling
+    static bool finishInit();           // First reading (waits out the settle time)
     static void shutdown();
 
     // Battery status
@@ -37,8 +40,10 @@ private:
     static uint16_t min_voltage;
     static uint16_t max_voltage;
     static uint32_t last_sample_time;
+    static uint32_t settle_start_us;
 
     static uint16_t readRawVoltage();
+    static void sample();
 };
 
 #endif // IONOS_BATTERY_DRIVER_H
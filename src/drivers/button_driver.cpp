@@ -1,5 +1,6 @@
 #include "button_driver.h"
 #include "../core/events.h"
+#include "../core/event_payload.h"
 
 // ============================================================================
 // ionOS v1.0 - BUTTON DRIVER IMPLEMENTATION
@@ -8,6 +9,13 @@
 
 // Static member initialization
 Button ButtonDriver::buttons[ButtonDriver::NUM_BUTTONS];
+SpscRing<ButtonEdge, BTN_EDGE_QUEUE_SIZE> ButtonDriver::edge_ring;
+SpscRing<Event, BTN_EVENT_QUEUE_SIZE> ButtonDriver::event_ring;
+void (*volatile ButtonDriver::edge_callback)() = nullptr;
+ButtonEdgeStats ButtonDriver::edge_stats = {0, 0, 0, 0};
+uint32_t ButtonDriver::edges_resynced = 0;
+
+static const uint32_t DEBOUNCE_US = BTN_DEBOUNCE_MS * 1000UL;
 
 // Pin mapping for 6 buttons
 const uint8_t ButtonDriver::button_pins[ButtonDriver::NUM_BUTTONS] = {
@@ -25,6 +33,8 @@ const uint8_t ButtonDriver::button_pins[ButtonDriver::NUM_BUTTONS] = {
 bool ButtonDriver::init() {
     Serial.println("[BUTTON] Initializing 6-button interface...");
 
+    uint32_t now_us = micros();
+
     // Configure GPIO pins
     for (int i = 0; i < NUM_BUTTONS; i++) {
         buttons[i].pin = button_pins[i];
@@ -32,13 +42,36 @@ bool ButtonDriver::init() {
         buttons[i].state = BTN_STATE_RELEASED;
         buttons[i].last_event = BTN_EVENT_NONE;
         buttons[i].press_time = 0;
-        buttons[i].last_stable_time = millis();
-        buttons[i].debouncing = false;
+        buttons[i].raw_pressed = false;
+        buttons[i].raw_time_us = now_us;
+        buttons[i].last_commit_us = now_us - DEBOUNCE_US;  // First edge is accepted at once
+        buttons[i].press_latched = false;
+        buttons[i].long_press_latched = false;
 
         // Configure pin as input with pull-up (most buttons support it)
         pinMode(buttons[i].pin, INPUT_PULLUP);
     }
 
+    edge_ring.clear();
+    Event stale;
+    while (event_ring.pop(stale)) {
+        EventPayloads::releaseEvent(stale);
+    }
+
+    // Pick up buttons already held at boot before edges start arriving
+    resyncPins(now_us);
+
+#if BTN_USE_INTERRUPTS
+    // One CHANGE interrupt per pin; the ISR only timestamps and queues.
+    // All GPIO ISRs are dispatched from one interrupt on one core, so the
+    // edge ring keeps a single producer.
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        attachInterruptArg(digitalPinToInterrupt(buttons[i].pin), onEdgeISR,
+                           (void*)(uintptr_t)i, CHANGE);
+    }
+    Serial.println("[BUTTON] Edge interrupts attached");
+#endif
+
     Serial.println("[BUTTON] Button driver initialized");
     printButtonStates();
     return true;
@@ -48,116 +81,228 @@ bool ButtonDriver::init() {
 // Shutdown button driver
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void ButtonDriver::shutdown() {
-    // Nothing to clean up
+#if BTN_USE_INTERRUPTS
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        detachInterrupt(digitalPinToInterrupt(buttons[i].pin));
+    }
+#endif
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Main update function (call from main loop ~100 Hz)
+// Edge ISR: timestamp the edge and queue it (no debouncing here)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void IRAM_ATTR ButtonDriver::onEdgeISR(void *arg) {
+    uint8_t index = (uint8_t)(uintptr_t)arg;
+
+    ButtonEdge edge;
+    edge.time_us = micros();
+    edge.index = index;
+    edge.pressed = digitalRead(buttons[index].pin) == LOW;
+    edge_stats.isr_edges++;
+
+    edge_ring.push(edge);
+
+    void (*callback)() = edge_callback;
+    if (callback != nullptr) {
+        callback();
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Main update function (kernel buttons task)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void ButtonDriver::update() {
-    uint32_t now = millis();
+#if BTN_USE_INTERRUPTS
+    ButtonEdge edge;
+    while (edge_ring.pop(edge)) {
+        processEdge(edge);
+    }
 
+    // A full ring lost edges; trust the pins over the queued history
+    uint32_t dropped = edge_ring.getDropped();
+    if (dropped != edges_resynced) {
+        edge_stats.dropped_edges += dropped - edges_resynced;
+        edges_resynced = dropped;
+        resyncPins(micros());
+    }
+#else
+    // Polling fallback: feed level changes through the same debounce path
+    uint32_t sample_us = micros();
     for (int i = 0; i < NUM_BUTTONS; i++) {
-        // Read raw pin state (inverted: HIGH = released, LOW = pressed)
-        bool raw_pressed = !readPin(buttons[i].pin);
+        bool pressed = !readPin(buttons[i].pin);
+        if (pressed != buttons[i].raw_pressed) {
+            ButtonEdge sampled = { sample_us, (uint8_t)i, pressed };
+            processEdge(sampled);
+        }
+    }
+#endif
 
-        // Debounce logic
-        debounceButton(i);
+    uint32_t now_us = micros();
+    uint32_t now = millis();
 
-        // Check for state transitions
-        if (buttons[i].state == BTN_STATE_RELEASED && raw_pressed) {
-            handleButtonPress(i);
-        } else if (buttons[i].state != BTN_STATE_RELEASED && !raw_pressed) {
-            handleButtonRelease(i);
-        }
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        // Commit a level that outlasted the debounce lockout
+        settleButton(i, now_us);
 
         // Check for long press while held
         if (buttons[i].state == BTN_STATE_PRESSED) {
             if (now - buttons[i].press_time >= BTN_LONG_PRESS_MS) {
                 buttons[i].state = BTN_STATE_HELD;
                 buttons[i].last_event = BTN_EVENT_LONG_PRESS;
+                buttons[i].long_press_latched = true;
 
-                // Post event to kernel
-                Event evt;
-                evt.type = EVENT_BUTTON_LONG_PRESS;
-                evt.priority = PRIORITY_HIGH;
-                evt.timestamp = now;
-                evt.data1 = buttons[i].id;
-                evt.data2 = buttons[i].press_time;
-                evt.data3 = nullptr;
-                // EventQueue::postEvent(evt);  // Uncomment when kernel ready
+                queueEvent(EVENT_BUTTON_LONG_PRESS, PRIORITY_HIGH,
+                           buttons[i].press_time + BTN_LONG_PRESS_MS, buttons[i].id);
             }
         }
     }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Debounce button state
+// Apply one raw edge in timestamp order
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-void ButtonDriver::debounceButton(uint8_t btn_index) {
-    if (btn_index >= NUM_BUTTONS) return;
+void ButtonDriver::processEdge(const ButtonEdge &edge) {
+    if (edge.index >= NUM_BUTTONS) return;
+
+    Button &btn = buttons[edge.index];
+
+    // Anything pending from before this edge settles first
+    settleButton(edge.index, edge.time_us);
 
+    btn.raw_pressed = edge.pressed;
+    btn.raw_time_us = edge.time_us;
+
+    // Leading-edge debounce: accept at once unless inside the lockout
+    settleButton(edge.index, edge.time_us);
+
+    if (btn.last_commit_us != edge.time_us) {
+        edge_stats.filtered_edges++;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Commit the raw level once the debounce lockout has expired
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void ButtonDriver::settleButton(uint8_t btn_index, uint32_t now_us) {
     Button &btn = buttons[btn_index];
-    uint32_t now = millis();
 
-    // If currently debouncing, check if debounce time has elapsed
-    if (btn.debouncing) {
-        if (now - btn.last_stable_time >= BTN_DEBOUNCE_MS) {
-            btn.debouncing = false;
-            btn.last_stable_time = now;
+    if (btn.raw_pressed == (btn.state != BTN_STATE_RELEASED)) return;
+
+    uint32_t unlock_us = btn.last_commit_us + DEBOUNCE_US;
+    if ((int32_t)(now_us - unlock_us) < 0) return;
+
+    // The level has held since its edge, or since the lockout ended
+    uint32_t at_us = (int32_t)(btn.raw_time_us - unlock_us) > 0 ? btn.raw_time_us : unlock_us;
+    commitTransition(btn_index, btn.raw_pressed, at_us);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Accept a debounced transition at a past micros() timestamp
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void ButtonDriver::commitTransition(uint8_t btn_index, bool pressed, uint32_t at_us) {
+    buttons[btn_index].last_commit_us = at_us;
+
+    // Convert to the millis() timeline the rest of the system uses
+    uint32_t at_ms = millis() - (micros() - at_us) / 1000;
+
+    if (pressed) {
+        handleButtonPress(btn_index, at_ms);
+    } else {
+        handleButtonRelease(btn_index, at_ms);
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Re-read every pin (boot, or after edges were dropped)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void ButtonDriver::resyncPins(uint32_t now_us) {
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        bool pressed = !readPin(buttons[i].pin);
+        if (pressed != buttons[i].raw_pressed) {
+            buttons[i].raw_pressed = pressed;
+            buttons[i].raw_time_us = now_us;
         }
+        settleButton(i, now_us);
     }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Handle button press
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-void ButtonDriver::handleButtonPress(uint8_t btn_index) {
+void ButtonDriver::handleButtonPress(uint8_t btn_index, uint32_t at_ms) {
     if (btn_index >= NUM_BUTTONS) return;
 
     Button &btn = buttons[btn_index];
-    uint32_t now = millis();
 
     btn.state = BTN_STATE_PRESSED;
-    btn.press_time = now;
+    btn.press_time = at_ms;
     btn.last_event = BTN_EVENT_SHORT_PRESS;
-    btn.debouncing = true;
-    btn.last_stable_time = now;
+    btn.press_latched = true;
 
-    // Post short press event
-    Event evt;
-    evt.type = EVENT_BUTTON_PRESS;
-    evt.priority = PRIORITY_HIGH;
-    evt.timestamp = now;
-    evt.data1 = btn.id;
-    evt.data2 = 0;
-    evt.data3 = nullptr;
-    // EventQueue::postEvent(evt);  // Uncomment when kernel ready
+    queueEvent(EVENT_BUTTON_PRESS, PRIORITY_HIGH, at_ms, btn.id);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Handle button release
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-void ButtonDriver::handleButtonRelease(uint8_t btn_index) {
+void ButtonDriver::handleButtonRelease(uint8_t btn_index, uint32_t at_ms) {
     if (btn_index >= NUM_BUTTONS) return;
 
     Button &btn = buttons[btn_index];
-    uint32_t now = millis();
 
     btn.state = BTN_STATE_RELEASED;
     btn.last_event = BTN_EVENT_RELEASE;
-    btn.debouncing = true;
-    btn.last_stable_time = now;
 
-    // Post release event
+    // The exact hold time rides in a pool payload; without a free block the
+    // release is still delivered, just without it
+    EventPayload *payload = EventPayloads::alloc(sizeof(ButtonPayload));
+    if (payload != nullptr) {
+        ButtonPayload *info = payload->as<ButtonPayload>();
+        info->press_ms = btn.press_time;
+        info->duration_ms = at_ms - btn.press_time;
+    }
+
+    queueEvent(EVENT_BUTTON_RELEASE, PRIORITY_NORMAL, at_ms, btn.id, payload);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Queue a debounced event for the kernel
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void ButtonDriver::queueEvent(EventType type, EventPriority priority, uint32_t at_ms, uint8_t btn_id,
+                              EventPayload *payload) {
     Event evt;
-    evt.type = EVENT_BUTTON_RELEASE;
-    evt.priority = PRIORITY_NORMAL;
-    evt.timestamp = now;
-    evt.data1 = btn.id;
-    evt.data2 = now - btn.press_time;  // Duration held in milliseconds
-    evt.data3 = nullptr;
-    // EventQueue::postEvent(evt);  // Uncomment when kernel ready
+    evt.type = type;
+    evt.priority = priority;
+    evt.timestamp = at_ms;
+    evt.data1 = btn_id;
+    evt.data2 = 0;
+    evt.data3 = payload;
+
+    if (!event_ring.push(evt)) {
+        EventPayloads::release(payload);
+        edge_stats.dropped_events++;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Pop the next debounced event
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool ButtonDriver::getNextEvent(Event &event) {
+    return event_ring.pop(event);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Register the ISR-context edge callback
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void ButtonDriver::setEdgeCallback(void (*callback)()) {
+    edge_callback = callback;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get edge capture counters
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+const ButtonEdgeStats& ButtonDriver::getEdgeStats() {
+    return edge_stats;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -215,8 +360,8 @@ bool ButtonDriver::isHeld(uint8_t btn_id) {
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool ButtonDriver::wasPressed(uint8_t btn_id) {
     if (btn_id >= NUM_BUTTONS) return false;
-    if (buttons[btn_id].last_event == BTN_EVENT_SHORT_PRESS) {
-        buttons[btn_id].last_event = BTN_EVENT_NONE;  // Clear
+    if (buttons[btn_id].press_latched) {
+        buttons[btn_id].press_latched = false;  // Clear
         return true;
     }
     return false;
@@ -227,8 +372,8 @@ bool ButtonDriver::wasPressed(uint8_t btn_id) {
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool ButtonDriver::wasLongPressed(uint8_t btn_id) {
     if (btn_id >= NUM_BUTTONS) return false;
-    if (buttons[btn_id].last_event == BTN_EVENT_LONG_PRESS) {
-        buttons[btn_id].last_event = BTN_EVENT_NONE;  // Clear
+    if (buttons[btn_id].long_press_latched) {
+        buttons[btn_id].long_press_latched = false;  // Clear
         return true;
     }
     return false;
@@ -268,6 +413,9 @@ void ButtonDriver::printDebugInfo() {
     Serial.printf("â•‘ Total buttons: %d\n", NUM_BUTTONS);
     Serial.printf("â•‘ Debounce time: %d ms\n", BTN_DEBOUNCE_MS);
     Serial.printf("â•‘ Long press threshold: %d ms\n", BTN_LONG_PRESS_MS);
+    Serial.printf("â•‘ Input mode: %s\n", BTN_USE_INTERRUPTS ? "edge IRQ" : "polling");
+    Serial.printf("â•‘ ISR edges: %u (filtered %u)\n", edge_stats.isr_edges, edge_stats.filtered_edges);
+    Serial.printf("â•‘ Dropped: %u edges, %u events\n", edge_stats.dropped_edges, edge_stats.dropped_events);
     Serial.println("â•‘\nâ•‘ Button States:");
 
     const char *btn_names[] = { "UP", "DOWN", "LEFT", "RIGHT", "SELECT", "BACK" };
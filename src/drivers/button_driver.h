@@ -4,11 +4,19 @@
 #include <stdint.h>
 #include <Arduino.h>
 #include "../config/pinmap.h"
+#include "../config/system_config.h"
+#include "../core/events.h"
+#include "../core/event_payload.h"
+#include "../core/spsc_ring.h"
 
 // ============================================================================
 // ionOS v1.0 - BUTTON DRIVER
 // Debounced input handling for 6-button layout
 // UP, DOWN, LEFT, RIGHT, SELECT, BACK
+//
+// GPIO edges are timestamped in the ISR and handed to task context through
+// a lock-free SPSC ring; update() debounces from those timestamps, so a
+// press shorter than a frame is still seen with its real press time.
 // ============================================================================
 
 enum ButtonState {
@@ -29,9 +37,27 @@ struct Button {
     uint8_t id;
     ButtonState state;
     ButtonEvent last_event;
-    uint32_t press_time;
-    uint32_t last_stable_time;
-    bool debouncing;
+    uint32_t press_time;       // millis() of the accepted press edge
+    bool raw_pressed;          // Level of the most recent raw edge
+    uint32_t raw_time_us;      // micros() of the most recent raw edge
+    uint32_t last_commit_us;   // micros() of the last accepted transition
+    bool press_latched;        // Consumed by wasPressed()
+    bool long_press_latched;   // Consumed by wasLongPressed()
+};
+
+// Raw edge captured in the GPIO ISR
+struct ButtonEdge {
+    uint32_t time_us;
+    uint8_t index;
+    bool pressed;
+};
+
+// Edge capture counters
+struct ButtonEdgeStats {
+    uint32_t isr_edges;        // Edges seen by the ISR
+    uint32_t filtered_edges;   // Edges absorbed by the debounce lockout
+    uint32_t dropped_edges;    // Edges lost to a full ring (pins resynced)
+    uint32_t dropped_events;   // Button events lost to a full event ring
 };
 
 class ButtonDriver {
@@ -40,9 +66,16 @@ public:
     static bool init();
     static void shutdown();
 
-    // Button polling (call from main loop)
+    // Drain captured edges, debounce, detect long presses (task context)
     static void update();
 
+    // Debounced events in the order they happened; false when empty
+    static bool getNextEvent(Event &event);
+
+    // Called from the edge ISR after queueing an edge (must be ISR-safe)
+    static void setEdgeCallback(void (*callback)());
+    static const ButtonEdgeStats& getEdgeStats();
+
     // Button state queries
     static ButtonState getButtonState(uint8_t btn_id);
     static ButtonEvent getLastEvent(uint8_t btn_id);
@@ -68,10 +101,24 @@ private:
     // Pin mapping (from pinmap.h)
     static const uint8_t button_pins[NUM_BUTTONS];
 
+    // ISR -> task edge ring, task -> kernel event ring
+    static SpscRing<ButtonEdge, BTN_EDGE_QUEUE_SIZE> edge_ring;
+    static SpscRing<Event, BTN_EVENT_QUEUE_SIZE> event_ring;
+    static void (*volatile edge_callback)();
+    static ButtonEdgeStats edge_stats;
+    static uint32_t edges_resynced;
+
+    static void IRAM_ATTR onEdgeISR(void *arg);
+
     // Debounce logic
-    static void debounceButton(uint8_t btn_index);
-    static void handleButtonPress(uint8_t btn_index);
-    static void handleButtonRelease(uint8_t btn_index);
+    static void processEdge(const ButtonEdge &edge);
+    static void settleButton(uint8_t btn_index, uint32_t now_us);
+    static void commitTransition(uint8_t btn_index, bool pressed, uint32_t at_us);
+    static void resyncPins(uint32_t now_us);
+    static void handleButtonPress(uint8_t btn_index, uint32_t at_ms);
+    static void handleButtonRelease(uint8_t btn_index, uint32_t at_ms);
+    static void queueEvent(EventType type, EventPriority priority, uint32_t at_ms, uint8_t btn_id,
+                           EventPayload *payload = nullptr);
     static bool readPin(uint8_t pin);
 };
 
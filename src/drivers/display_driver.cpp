@@ -1,6 +1,7 @@
 #include "display_driver.h"
 #include "../config/pinmap.h"
 #include "../config/system_config.h"
+#include "../core/memory.h"
 #include <U8g2lib.h>
 #include <Wire.h>
 
@@ -12,6 +13,24 @@
 U8G2 *DisplayDriver::u8g2 = nullptr;
 bool DisplayDriver::initialized = false;
 uint8_t DisplayDriver::backlight_level = 255;
+uint8_t DisplayDriver::text_color = 1;
+const uint8_t *DisplayDriver::current_font = u8g2_font_6x10_tf;
+const uint8_t *DisplayDriver::u8g2_font = nullptr;
+TextLayout DisplayDriver::text_layouts[TEXT_LAYOUT_SLOTS];
+uint32_t DisplayDriver::layout_use[TEXT_LAYOUT_SLOTS] = { 0 };
+uint32_t DisplayDriver::layout_clock = 0;
+uint16_t DisplayDriver::dirty_tiles[DisplayDriver::NUM_PAGES] = { 0 };
+uint16_t DisplayDriver::drawn_tiles[DisplayDriver::NUM_PAGES] = { 0 };
+DisplayFlushStats DisplayDriver::flush_stats = { 0, 0, 0, 0 };
+uint32_t DisplayDriver::prev_frame[DisplayDriver::FRAME_WORDS] = { 0 };
+bool DisplayDriver::force_full = false;
+
+// All tile bits of one page
+static const uint16_t PAGE_ALL_TILES = 0xFFFF;
+
+static inline RasterOp colorOp(bool color) {
+    return color ? RASTER_OR : RASTER_CLEAR;
+}
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Initialize display
@@ -21,31 +40,64 @@ bool DisplayDriver::init() {
         return true;
     }
 
-    // Create U8G2 instance (SSD1306 128x64, I2C)
+    // Create U8G2 instance (SSD1306 128x64, I2C) in the boot arena; it
+    // lives for the whole run, so a re-init after shutdown() reuses it
     // Using full buffer mode for better performance
-    u8g2 = new U8G2_SSD1306_128X64_NONAME_F_HW_I2C(
-        U8G2_R0,                    // Rotation 0
-        U8X8_PIN_NONE,              // Reset (not used)
-        DISPLAY_SCL,                // SCL pin
-        DISPLAY_SDA                 // SDA pin
-    );
+    if (u8g2 == nullptr) {
+        u8g2 = MemoryManager::create<U8G2_SSD1306_128X64_NONAME_F_HW_I2C>(
+            MEM_DRIVERS,
+            U8G2_R0,                    // Rotation 0
+            U8X8_PIN_NONE,              // Reset (not used)
+            DISPLAY_SCL,                // SCL pin
+            DISPLAY_SDA                 // SDA pin
+        );
+    }
 
     if (u8g2 == nullptr) {
         Serial.println("[DISPLAY] Failed to allocate U8G2 memory");
         return false;
     }
 
+    // u8g2 writes blind, so probe for the panel first
+    Wire.begin(DISPLAY_SDA, DISPLAY_SCL, DISPLAY_I2C_FREQ);
+    Wire.beginTransmission(DISPLAY_ADDR);
+    uint8_t error = Wire.endTransmission();
+    if (error != 0) {
+        Serial.printf("[DISPLAY] No panel at 0x%02X (I2C error %d)\n", DISPLAY_ADDR, error);
+        return false;
+    }
+
     // Begin with I2C address
-    u8g2->setI2CAddress(DISPLAY_I2C_ADDR * 2);  // U8G2 uses 7-bit address shifted
+    u8g2->setI2CAddress(DISPLAY_ADDR * 2);  // U8G2 uses 7-bit address shifted
+    u8g2->setBusClock(DISPLAY_I2C_FREQ);
     u8g2->begin();
 
     // Configure display
     u8g2->setContrast(180);
-    u8g2->setFont(u8g2_font_6x10_tf);
+    u8g2->setFontRefHeightAll();    // Ascent/descent cover every glyph, not just 'A'/'g'
+    u8g2->setFont(current_font);
+    u8g2_font = current_font;
     u8g2->setDrawColor(1);  // White pixels
+    text_color = 1;
     u8g2->clearBuffer();
     u8g2->sendBuffer();
 
+    // Primitives draw straight into U8g2's page buffer
+    Raster::setTarget(u8g2->getBufferPtr());
+    Raster::resetClip();
+
+    // Text is rasterized by U8g2 once per glyph, then blitted
+    GlyphCache::init({ fontMetrics, renderGlyph });
+    for (uint8_t i = 0; i < TEXT_LAYOUT_SLOTS; i++) {
+        text_layouts[i].invalidate();
+    }
+
+    // Panel now matches the (empty) buffer
+    memset(dirty_tiles, 0, sizeof(dirty_tiles));
+    memset(drawn_tiles, 0, sizeof(drawn_tiles));
+    memset(prev_frame, 0, sizeof(prev_frame));
+    force_full = false;
+
     initialized = true;
     Serial.println("[DISPLAY] Initialized SSD1306 128x64 OLED");
     return true;
@@ -58,10 +110,9 @@ void DisplayDriver::shutdown() {
     if (u8g2 != nullptr) {
         u8g2->clearBuffer();
         u8g2->sendBuffer();
-        u8g2->setPowerSave(1);  // Power save mode
-        delete u8g2;
-        u8g2 = nullptr;
+        u8g2->setPowerSave(1);  // Power save mode (object stays in the arena)
     }
+    Raster::setTarget(nullptr);
     initialized = false;
 }
 
@@ -77,15 +128,157 @@ bool DisplayDriver::isInitialized() {
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void DisplayDriver::clear() {
     if (!isInitialized()) return;
-    u8g2->clearBuffer();
+    Raster::clear();
+
+    // Everything drawn since the last clear is being erased
+    for (uint8_t page = 0; page < NUM_PAGES; page++) {
+        dirty_tiles[page] |= drawn_tiles[page];
+        drawn_tiles[page] = 0;
+    }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Send buffer to display
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-void DisplayDriver::display() {
-    if (!isInitialized()) return;
-    u8g2->sendBuffer();
+bool DisplayDriver::display() {
+    if (!isInitialized()) return false;
+
+    uint8_t *buffer = u8g2->getBufferPtr();
+
+    if (force_full) {
+        u8g2->sendBuffer();
+        flush_stats.full_flushes++;
+        force_full = false;
+    } else {
+#if DISPLAY_PARTIAL_UPDATE
+        bool sent = flushDirtyTiles(buffer);
+#else
+        bool sent = frameChanged(buffer);
+        if (sent) {
+            u8g2->sendBuffer();
+            flush_stats.full_flushes++;
+        }
+#endif
+        if (!sent) {
+            // Identical to what the panel already shows
+            flush_stats.skipped_frames++;
+            memset(dirty_tiles, 0, sizeof(dirty_tiles));
+            return false;
+        }
+    }
+
+    memcpy(prev_frame, buffer, sizeof(prev_frame));
+    memset(dirty_tiles, 0, sizeof(dirty_tiles));
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Force a full flush on the next display()
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::invalidate() {
+    force_full = true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Compare one 8x8 tile (8 bytes at offset) with the previous frame
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool DisplayDriver::tileChanged(const uint8_t *buffer, uint16_t offset) {
+    // Two 32-bit compares per tile; memcpy avoids unaligned loads
+    uint32_t words[2];
+    memcpy(words, buffer + offset, sizeof(words));
+    const uint32_t *prev = &prev_frame[offset / 4];
+    return (words[0] != prev[0]) || (words[1] != prev[1]);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Word-wise compare of the whole frame with the previous frame
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool DisplayDriver::frameChanged(const uint8_t *buffer) {
+    for (uint16_t i = 0; i < FRAME_WORDS; i++) {
+        uint32_t word;
+        memcpy(&word, buffer + i * 4, sizeof(word));
+        if (word != prev_frame[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Mark the tiles covering an inclusive pixel box as dirty
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    if (x1 < 0 || y1 < 0 || x0 >= DISPLAY_WIDTH || y0 >= DISPLAY_HEIGHT) return;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= DISPLAY_WIDTH) x1 = DISPLAY_WIDTH - 1;
+    if (y1 >= DISPLAY_HEIGHT) y1 = DISPLAY_HEIGHT - 1;
+
+    uint8_t first_tile = x0 / 8;
+    uint8_t last_tile = x1 / 8;
+    uint16_t mask = (uint16_t)(((1UL << (last_tile + 1)) - 1) & ~((1UL << first_tile) - 1));
+
+    for (uint8_t page = y0 / 8; page <= y1 / 8; page++) {
+        dirty_tiles[page] |= mask;
+        drawn_tiles[page] |= mask;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Send changed tiles, one updateDisplayArea() per run of adjacent tiles
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool DisplayDriver::flushDirtyTiles(const uint8_t *buffer) {
+    bool any_dirty = false;
+    bool all_dirty = true;
+    for (uint8_t page = 0; page < NUM_PAGES; page++) {
+        // Drop tiles that were redrawn with identical content
+        uint16_t changed = 0;
+        for (uint8_t tx = 0; tx < TILES_PER_PAGE; tx++) {
+            if ((dirty_tiles[page] & (1 << tx)) &&
+                tileChanged(buffer, page * DISPLAY_WIDTH + tx * 8)) {
+                changed |= (1 << tx);
+            }
+        }
+        dirty_tiles[page] = changed;
+
+        if (changed != 0) any_dirty = true;
+        if (changed != PAGE_ALL_TILES) all_dirty = false;
+    }
+
+    if (!any_dirty) {
+        return false;
+    }
+
+    if (all_dirty) {
+        // A single transfer beats 8 page-sized ones
+        u8g2->sendBuffer();
+        flush_stats.full_flushes++;
+    } else {
+        for (uint8_t page = 0; page < NUM_PAGES; page++) {
+            uint16_t mask = dirty_tiles[page];
+            uint8_t tx = 0;
+
+            while (mask != 0) {
+                // Skip clean tiles, then measure the dirty run
+                while (!(mask & 1)) {
+                    mask >>= 1;
+                    tx++;
+                }
+                uint8_t tw = 0;
+                while (mask & 1) {
+                    mask >>= 1;
+                    tw++;
+                }
+
+                u8g2->updateDisplayArea(tx, page, tw, 1);
+                flush_stats.tiles_sent += tw;
+                tx += tw;
+            }
+        }
+        flush_stats.partial_flushes++;
+    }
+
+    return true;
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -108,45 +301,56 @@ void DisplayDriver::setPowerMode(bool on) {
 // Draw pixel
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void DisplayDriver::drawPixel(uint16_t x, uint16_t y, bool color) {
-    if (!isInitialized()) return;
     if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
-    u8g2->setDrawColor(color ? 1 : 0);
-    u8g2->drawPixel(x, y);
+    Raster::pixel(x, y, colorOp(color));
+    markDirty(x, y, x, y);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Draw line
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void DisplayDriver::drawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, bool color) {
-    if (!isInitialized()) return;
-    u8g2->setDrawColor(color ? 1 : 0);
-    u8g2->drawLine(x1, y1, x2, y2);
+    Raster::line(x1, y1, x2, y2, colorOp(color));
+    markDirty(min(x1, x2), min(y1, y2), max(x1, x2), max(y1, y2));
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Draw rectangle
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void DisplayDriver::drawRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool fill, bool color) {
-    if (!isInitialized()) return;
-    u8g2->setDrawColor(color ? 1 : 0);
     if (fill) {
-        u8g2->drawBox(x, y, w, h);
+        Raster::fillRect(x, y, w, h, colorOp(color));
     } else {
-        u8g2->drawFrame(x, y, w, h);
+        Raster::frame(x, y, w, h, colorOp(color));
     }
+    markDirty(x, y, x + w - 1, y + h - 1);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Draw circle
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void DisplayDriver::drawCircle(uint16_t x, uint16_t y, uint16_t radius, bool fill, bool color) {
-    if (!isInitialized()) return;
-    u8g2->setDrawColor(color ? 1 : 0);
-    if (fill) {
-        u8g2->drawDisc(x, y, radius, U8G2_DRAW_ALL);
-    } else {
-        u8g2->drawCircle(x, y, radius, U8G2_DRAW_ALL);
-    }
+    Raster::circle(x, y, radius, fill, colorOp(color));
+    markDirty(x - radius, y - radius, x + radius, y + radius);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Fill a rectangle with a raster op
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, RasterOp op) {
+    if (w <= 0 || h <= 0) return;
+    Raster::fillRect(x, y, w, h, op);
+    markDirty(x, y, x + w - 1, y + h - 1);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Draw a page-major bitmap
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                               int16_t w, int16_t h, RasterOp op) {
+    if (w <= 0 || h <= 0) return;
+    Raster::blit(x, y, bitmap, w, h, op);
+    markDirty(x, y, x + w - 1, y + h - 1);
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -154,8 +358,177 @@ void DisplayDriver::drawCircle(uint16_t x, uint16_t y, uint16_t radius, bool fil
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void DisplayDriver::drawString(uint16_t x, uint16_t y, const char *str, bool color) {
     if (!isInitialized() || !str) return;
-    u8g2->setDrawColor(color ? 1 : 0);
-    u8g2->drawStr(x, y, str);
+
+    // Strings drawn recently are redrawn from their layout
+    TextLayout *layout = findLayout(str);
+    if (layout != nullptr) {
+        drawText(x, y, *layout, color);
+        return;
+    }
+
+    // Too long for a layout: blit the cached glyphs one by one
+    FontMetrics metrics;
+    if (GlyphCache::getMetrics(current_font, metrics)) {
+        const int16_t top = (int16_t)y - metrics.ascent;
+        const int16_t height = metrics.ascent - metrics.descent;
+        const RasterOp op = colorOp(color);
+        int16_t pen = x;
+        int16_t right = x - 1;
+        for (const char *c = str; *c; c++) {
+            const Glyph *glyph = GlyphCache::get(current_font, (uint8_t)*c);
+            if (glyph == nullptr) continue;
+            Raster::blit(pen, top, glyph->bits, glyph->width, height, op);
+            if (pen + glyph->width - 1 > right) right = pen + glyph->width - 1;
+            pen += glyph->advance;
+        }
+        markDirty(x, top, right, top + height - 1);
+        return;
+    }
+
+    // Font too large for the cache
+    useFont(current_font);
+    setTextColor(color);
+    uint16_t width = u8g2->drawStr(x, y, str);
+
+    // y is the baseline: glyphs span from the ascent above to the descent below
+    markDirty(x, y - u8g2->getAscent(), x + width - 1, y - u8g2->getDescent());
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Draw a rendered string (one blit)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::drawText(int16_t x, int16_t y, const TextLayout &layout, bool color) {
+    if (!layout.isValid() || layout.getColumns() == 0) return;
+
+    const int16_t top = y - layout.getMetrics().ascent;
+    Raster::blit(x, top, layout.getBitmap(), layout.getColumns(), layout.getHeight(), colorOp(color));
+    markDirty(x, top, x + layout.getColumns() - 1, top + layout.getHeight() - 1);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Font for drawString
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::setFont(const uint8_t *font) {
+    if (font != nullptr) current_font = font;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Exact string width (advance sum, as drawStr returns it)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint16_t DisplayDriver::getStringWidth(const char *str, const uint8_t *font) {
+    if (str == nullptr) return 0;
+    if (font == nullptr) font = current_font;
+
+    uint16_t width;
+    if (GlyphCache::measure(font, str, width)) return width;
+
+    if (!isInitialized()) return 0;
+    useFont(font);
+    return u8g2->getStrWidth(str);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Layout of a recently drawn string, or a new one in the oldest slot
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+TextLayout* DisplayDriver::findLayout(const char *str) {
+    uint8_t oldest = 0;
+    for (uint8_t i = 0; i < TEXT_LAYOUT_SLOTS; i++) {
+        if (text_layouts[i].matches(str, current_font)) {
+            layout_use[i] = ++layout_clock;
+            return &text_layouts[i];
+        }
+        if (layout_use[i] < layout_use[oldest]) oldest = i;
+    }
+
+    // Keep the slot for strings that could never fit
+    if (strlen(str) > TEXT_LAYOUT_MAX_CHARS) return nullptr;
+    if (!text_layouts[oldest].set(str, current_font)) return nullptr;
+    layout_use[oldest] = ++layout_clock;
+    return &text_layouts[oldest];
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// U8g2 state used by the text path
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::useFont(const uint8_t *font) {
+    if (font != u8g2_font) {
+        u8g2->setFont(font);
+        u8g2_font = font;
+    }
+}
+
+void DisplayDriver::setTextColor(bool color) {
+    uint8_t draw_color = color ? 1 : 0;
+    if (draw_color != text_color) {
+        u8g2->setDrawColor(draw_color);
+        text_color = draw_color;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// GlyphSource: font metrics from U8g2
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool DisplayDriver::fontMetrics(const uint8_t *font, FontMetrics &out) {
+    if (!isInitialized()) return false;
+    useFont(font);
+    out.ascent = u8g2->getAscent();
+    out.descent = u8g2->getDescent();
+    out.max_width = u8g2->getMaxCharWidth();
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// GlyphSource: rasterize one glyph with U8g2
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool DisplayDriver::renderGlyph(const uint8_t *font, uint8_t code, const FontMetrics &metrics, Glyph &out) {
+    if (!isInitialized() || code == 0) return false;
+    uint8_t *buffer = u8g2->getBufferPtr();
+
+    // Borrow the top-left corner of the frame buffer as scratch, with the
+    // glyph's ascent line on row 0, and put the frame back afterwards
+    uint8_t saved[GLYPH_PAGES][GLYPH_MAX_WIDTH];
+    for (uint8_t page = 0; page < GLYPH_PAGES; page++) {
+        memcpy(saved[page], buffer + page * DISPLAY_WIDTH, GLYPH_MAX_WIDTH);
+        memset(buffer + page * DISPLAY_WIDTH, 0, GLYPH_MAX_WIDTH);
+    }
+
+    useFont(font);
+    setTextColor(true);
+    const char str[2] = { (char)code, '\0' };
+    out.advance = (uint8_t)u8g2->drawStr(0, metrics.ascent, str);
+    out.width = metrics.max_width;
+
+    for (uint8_t page = 0; page < GLYPH_PAGES; page++) {
+        memcpy(out.bits + page * out.width, buffer + page * DISPLAY_WIDTH, out.width);
+        memcpy(buffer + page * DISPLAY_WIDTH, saved[page], GLYPH_MAX_WIDTH);
+    }
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Clip rectangle
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::setClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+    Raster::setClip(x, y, w, h);
+}
+
+void DisplayDriver::resetClip() {
+    Raster::resetClip();
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Mark a box drawn through Raster as changed
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::markDrawn(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (w <= 0 || h <= 0) return;
+    markDirty(x, y, x + w - 1, y + h - 1);
+}
+
+void DisplayDriver::markDrawnTiles(const uint16_t tiles[DISPLAY_HEIGHT / 8]) {
+    for (uint8_t page = 0; page < NUM_PAGES; page++) {
+        dirty_tiles[page] |= tiles[page];
+        drawn_tiles[page] |= tiles[page];
+    }
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -189,6 +562,13 @@ uint16_t DisplayDriver::getHeight() {
     return DISPLAY_HEIGHT;
 }
 
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get panel flush counters
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void DisplayDriver::getFlushStats(DisplayFlushStats &stats) {
+    stats = flush_stats;
+}
+
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Print debug information
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -198,7 +578,14 @@ void DisplayDriver::printDebugInfo() {
     Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
     Serial.printf("â•‘ Initialized: %s\n", initialized ? "YES" : "NO");
     Serial.printf("â•‘ Width: %d, Height: %d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
-    Serial.printf("â•‘ I2C Address: 0x%02X\n", DISPLAY_I2C_ADDR);
+    Serial.printf("â•‘ I2C Address: 0x%02X\n", DISPLAY_ADDR);
     Serial.printf("â•‘ Backlight: %d/255\n", backlight_level);
+    Serial.printf("â•‘ Flushes: %lu full, %lu partial (%lu tiles)\n",
+        (unsigned long)flush_stats.full_flushes, (unsigned long)flush_stats.partial_flushes,
+        (unsigned long)flush_stats.tiles_sent);
+    Serial.printf("â•‘ Skipped Frames: %lu\n", (unsigned long)flush_stats.skipped_frames);
+    Serial.printf("â•‘ Glyph Cache: %u/%d glyphs, %lu hits, %lu misses\n",
+        GlyphCache::getUsedCount(), GLYPH_CACHE_SLOTS,
+        (unsigned long)GlyphCache::getHits(), (unsigned long)GlyphCache::getMisses());
     Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
 }
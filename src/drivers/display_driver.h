@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 #include <Arduino.h>
+#include "raster.h"
+#include "glyph_cache.h"
 
 // Forward declaration
 class U8G2;
@@ -11,6 +13,14 @@ class U8G2;
 // ionOS v1.0 - DISPLAY DRIVER (SSD1306 OLED)
 // ============================================================================
 
+// Panel flush counters
+struct DisplayFlushStats {
+    uint32_t full_flushes;      // Whole-frame sendBuffer() transfers
+    uint32_t partial_flushes;   // Frames sent as dirty tile runs
+    uint32_t tiles_sent;        // 8x8 tiles sent by partial flushes
+    uint32_t skipped_frames;    // display() calls where nothing changed
+};
+
 class DisplayDriver {
 public:
     // Initialization & lifecycle
@@ -20,16 +30,37 @@ public:
 
     // Rendering
     static void clear();
-    static void display();
+    static bool display();      // Returns false if the frame was unchanged and skipped
+    static void invalidate();   // Force a full flush on the next display()
     static void setContrast(uint8_t value);
     static void setPowerMode(bool on);
 
-    // Drawing primitives
+    // Drawing primitives (rendered by Raster into the U8g2 frame buffer)
     static void drawPixel(uint16_t x, uint16_t y, bool color);
     static void drawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, bool color);
     static void drawRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool fill, bool color);
     static void drawCircle(uint16_t x, uint16_t y, uint16_t radius, bool fill, bool color);
+    static void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, RasterOp op);
+    static void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                           int16_t w, int16_t h, RasterOp op = RASTER_OR);
+
+    // Text (y is the baseline). drawString keeps the last TEXT_LAYOUT_SLOTS
+    // strings rendered; callers redrawing their own strings can hold a
+    // TextLayout and use drawText. Fonts too large for the glyph cache are
+    // drawn by U8g2 and ignore the clip rectangle.
     static void drawString(uint16_t x, uint16_t y, const char *str, bool color);
+    static void drawText(int16_t x, int16_t y, const TextLayout &layout, bool color);
+    static void setFont(const uint8_t *font);
+    static const uint8_t* getFont() { return current_font; }
+    static uint16_t getStringWidth(const char *str, const uint8_t *font = nullptr);
+
+    // Clip rectangle for the primitives above
+    static void setClip(int16_t x, int16_t y, int16_t w, int16_t h);
+    static void resetClip();
+
+    // Mark a box drawn straight through Raster (sprites) as changed
+    static void markDrawn(int16_t x, int16_t y, int16_t w, int16_t h);
+    static void markDrawnTiles(const uint16_t tiles[DISPLAY_HEIGHT / 8]);  // One tile mask per page
 
     // Backlight control
     static void setBacklight(uint8_t brightness);
@@ -38,12 +69,45 @@ public:
     // Info
     static uint16_t getWidth();
     static uint16_t getHeight();
+    static void getFlushStats(DisplayFlushStats &stats);
     static void printDebugInfo();
 
 private:
     static U8G2 *u8g2;
     static bool initialized;
     static uint8_t backlight_level;
+    static uint8_t text_color;      // Last U8g2 draw color set for text
+    static const uint8_t *current_font;     // Font for drawString
+    static const uint8_t *u8g2_font;        // Font currently set on U8g2
+
+    // Recently drawn strings, least recently used replaced first
+    static TextLayout text_layouts[TEXT_LAYOUT_SLOTS];
+    static uint32_t layout_use[TEXT_LAYOUT_SLOTS];
+    static uint32_t layout_clock;
+
+    // Dirty tracking: one bit per 8x8 tile column, one word per SSD1306 page
+    static const uint8_t NUM_PAGES = 8;         // 64 rows / 8
+    static const uint8_t TILES_PER_PAGE = 16;   // 128 columns / 8
+    static uint16_t dirty_tiles[NUM_PAGES];     // Changed since last flush
+    static uint16_t drawn_tiles[NUM_PAGES];     // Holding content since last clear()
+    static DisplayFlushStats flush_stats;
+
+    // Copy of the last frame sent to the panel, for frame diffing
+    static const uint16_t FRAME_WORDS = 128 * 64 / 8 / 4;
+    static uint32_t prev_frame[FRAME_WORDS];
+    static bool force_full;
+
+    static void markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    static bool flushDirtyTiles(const uint8_t *buffer);
+    static bool tileChanged(const uint8_t *buffer, uint16_t offset);
+    static bool frameChanged(const uint8_t *buffer);
+
+    // Text helpers
+    static void useFont(const uint8_t *font);
+    static void setTextColor(bool color);
+    static TextLayout* findLayout(const char *str);
+    static bool fontMetrics(const uint8_t *font, FontMetrics &out);
+    static bool renderGlyph(const uint8_t *font, uint8_t code, const FontMetrics &metrics, Glyph &out);
 };
 
 #endif // IONOS_DISPLAY_DRIVER_H
@@ -0,0 +1,172 @@
+#include "glyph_cache.h"
+#include <string.h>
+
+// ============================================================================
+// ionOS v1.0 - GLYPH CACHE & TEXT LAYOUT IMPLEMENTATION
+// ============================================================================
+
+// Static member initialization
+GlyphSource GlyphCache::source = { nullptr, nullptr };
+Glyph GlyphCache::slots[GLYPH_CACHE_SLOTS];
+GlyphCache::FontEntry GlyphCache::fonts[GlyphCache::FONT_ENTRIES];
+uint8_t GlyphCache::next_font = 0;
+uint32_t GlyphCache::use_clock = 0;
+uint32_t GlyphCache::hits = 0;
+uint32_t GlyphCache::misses = 0;
+uint32_t GlyphCache::evictions = 0;
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Initialize with the glyph source
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void GlyphCache::init(const GlyphSource &glyph_source) {
+    source = glyph_source;
+    clear();
+}
+
+void GlyphCache::clear() {
+    for (uint16_t i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        slots[i].font = nullptr;
+    }
+    for (uint8_t i = 0; i < FONT_ENTRIES; i++) {
+        fonts[i].font = nullptr;
+    }
+    next_font = 0;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Font metrics (looked up once per font, round-robin replacement)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+const GlyphCache::FontEntry* GlyphCache::findFont(const uint8_t *font) {
+    if (font == nullptr) return nullptr;
+    for (uint8_t i = 0; i < FONT_ENTRIES; i++) {
+        if (fonts[i].font == font) return &fonts[i];
+    }
+
+    // Not remembered on failure, so a later call asks again
+    FontMetrics metrics;
+    if (source.metrics == nullptr || !source.metrics(font, metrics)) return nullptr;
+
+    FontEntry &entry = fonts[next_font];
+    next_font = (next_font + 1) % FONT_ENTRIES;
+    entry.font = font;
+    entry.metrics = metrics;
+    int16_t height = metrics.ascent - metrics.descent;
+    entry.cacheable = metrics.max_width > 0 && metrics.max_width <= GLYPH_MAX_WIDTH &&
+                      height > 0 && height <= GLYPH_MAX_HEIGHT;
+    return &entry;
+}
+
+bool GlyphCache::getMetrics(const uint8_t *font, FontMetrics &out) {
+    const FontEntry *entry = findFont(font);
+    if (entry == nullptr || !entry->cacheable) return false;
+    out = entry->metrics;
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Glyph lookup: hashed probe window, least recently used slot replaced
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+const Glyph* GlyphCache::get(const uint8_t *font, uint8_t code) {
+    const FontEntry *entry = findFont(font);
+    if (entry == nullptr || !entry->cacheable) return nullptr;
+
+    uint16_t start = (uint16_t)(((uint32_t)((uintptr_t)font >> 2) * 31u + code) % GLYPH_CACHE_SLOTS);
+    Glyph *victim = nullptr;
+    for (uint8_t i = 0; i < PROBE_LENGTH; i++) {
+        Glyph &glyph = slots[(start + i) % GLYPH_CACHE_SLOTS];
+        if (glyph.font == font && glyph.code == code) {
+            hits++;
+            glyph.last_use = ++use_clock;
+            return &glyph;
+        }
+        // Prefer a free slot, else the oldest one
+        if (victim == nullptr ||
+            (victim->font != nullptr && (glyph.font == nullptr || glyph.last_use < victim->last_use))) {
+            victim = &glyph;
+        }
+    }
+
+    misses++;
+    if (victim->font != nullptr) evictions++;
+    victim->font = nullptr;
+    if (source.render == nullptr || !source.render(font, code, entry->metrics, *victim)) {
+        return nullptr;
+    }
+    victim->font = font;
+    victim->code = code;
+    victim->last_use = ++use_clock;
+    return victim;
+}
+
+bool GlyphCache::measure(const uint8_t *font, const char *text, uint16_t &width) {
+    width = 0;
+    if (text == nullptr) return true;
+    for (const char *c = text; *c; c++) {
+        const Glyph *glyph = get(font, (uint8_t)*c);
+        if (glyph == nullptr) return false;
+        width += glyph->advance;
+    }
+    return true;
+}
+
+uint8_t GlyphCache::getUsedCount() {
+    uint8_t used = 0;
+    for (uint16_t i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        if (slots[i].font != nullptr) used++;
+    }
+    return used;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Text layout
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+TextLayout::TextLayout() : font(nullptr), width(0), columns(0), metrics({ 0, 0, 0 }), valid(false) {
+    text[0] = '\0';
+}
+
+bool TextLayout::matches(const char *str, const uint8_t *str_font) const {
+    return valid && str != nullptr && font == str_font && strcmp(text, str) == 0;
+}
+
+bool TextLayout::set(const char *str, const uint8_t *str_font) {
+    if (matches(str, str_font)) return true;
+
+    valid = false;
+    if (str == nullptr || strlen(str) > TEXT_LAYOUT_MAX_CHARS) return false;
+    if (!GlyphCache::getMetrics(str_font, metrics)) return false;
+
+    // First pass: advance width and bitmap columns
+    uint16_t pen = 0;
+    uint16_t span = 0;
+    for (const char *c = str; *c; c++) {
+        const Glyph *glyph = GlyphCache::get(str_font, (uint8_t)*c);
+        if (glyph == nullptr) return false;
+        if (pen + glyph->width > span) span = pen + glyph->width;
+        pen += glyph->advance;
+    }
+    if (span < pen) span = pen;
+    if (span > DISPLAY_WIDTH) return false;
+
+    // Second pass: OR each glyph's bands in at its pen position
+    columns = (uint8_t)span;
+    memset(bits, 0, (size_t)columns * GLYPH_PAGES);
+    pen = 0;
+    for (const char *c = str; *c; c++) {
+        const Glyph *glyph = GlyphCache::get(str_font, (uint8_t)*c);
+        if (glyph == nullptr) return false;
+        for (uint8_t band = 0; band < GLYPH_PAGES; band++) {
+            uint8_t *dst = bits + band * columns + pen;
+            const uint8_t *src = glyph->bits + band * glyph->width;
+            for (uint8_t col = 0; col < glyph->width; col++) {
+                dst[col] |= src[col];
+            }
+        }
+        pen += glyph->advance;
+    }
+
+    strcpy(text, str);
+    font = str_font;
+    width = pen;
+    valid = true;
+    return true;
+}
@@ -0,0 +1,116 @@
+#ifndef IONOS_GLYPH_CACHE_H
+#define IONOS_GLYPH_CACHE_H
+
+#include <stdint.h>
+#include "../config/system_config.h"
+
+// ============================================================================
+// ionOS v1.0 - GLYPH CACHE & TEXT LAYOUT
+// U8g2 decodes its compressed fonts on every drawStr(). GlyphCache keeps
+// glyphs rasterized once into page-major bitmaps (the frame buffer layout),
+// so text becomes Raster blits. TextLayout goes one step further and keeps
+// a whole string rendered, with its width, so redrawing an unchanged string
+// is a single blit. Glyphs come from a GlyphSource supplied by the display
+// driver, which owns U8g2; fonts whose glyphs exceed GLYPH_MAX_WIDTH x
+// GLYPH_MAX_HEIGHT are not cached and keep going through U8g2.
+// ============================================================================
+
+static const uint8_t GLYPH_PAGES = (GLYPH_MAX_HEIGHT + 7) / 8;
+
+// Font extents (as U8g2 reports them with setFontRefHeightAll())
+struct FontMetrics {
+    int8_t ascent;          // Rows above the baseline
+    int8_t descent;         // Rows below the baseline, <= 0
+    uint8_t max_width;      // Widest glyph bitmap
+};
+
+// One rasterized glyph. Row 0 of the bitmap is the ascent line, so a glyph
+// drawn at baseline y is blitted at y - ascent.
+struct Glyph {
+    const uint8_t *font;    // nullptr = free slot
+    uint8_t code;
+    uint8_t advance;        // Pen movement to the next glyph
+    uint8_t width;          // Bitmap columns (the font's max_width)
+    uint32_t last_use;
+    uint8_t bits[GLYPH_MAX_WIDTH * GLYPH_PAGES];    // width bytes per band
+};
+
+// Where glyphs come from (implemented by DisplayDriver on top of U8g2)
+struct GlyphSource {
+    bool (*metrics)(const uint8_t *font, FontMetrics &out);
+    bool (*render)(const uint8_t *font, uint8_t code, const FontMetrics &metrics, Glyph &out);
+};
+
+class GlyphCache {
+public:
+    static void init(const GlyphSource &source);
+    static void clear();
+
+    // Metrics of a font; false if it cannot be cached (glyphs too large)
+    static bool getMetrics(const uint8_t *font, FontMetrics &out);
+
+    // Cached glyph, rasterized on a miss; nullptr if the font is not cacheable
+    static const Glyph* get(const uint8_t *font, uint8_t code);
+
+    // Exact advance width of a string; false if the font is not cacheable
+    static bool measure(const uint8_t *font, const char *text, uint16_t &width);
+
+    // Stats
+    static uint32_t getHits() { return hits; }
+    static uint32_t getMisses() { return misses; }
+    static uint32_t getEvictions() { return evictions; }
+    static uint8_t getUsedCount();
+
+private:
+    struct FontEntry {
+        const uint8_t *font;
+        FontMetrics metrics;
+        bool cacheable;
+    };
+
+    static const uint8_t PROBE_LENGTH = 8;  // Slots searched per glyph
+    static const uint8_t FONT_ENTRIES = 4;
+
+    static GlyphSource source;
+    static Glyph slots[GLYPH_CACHE_SLOTS];
+    static FontEntry fonts[FONT_ENTRIES];
+    static uint8_t next_font;
+    static uint32_t use_clock;
+    static uint32_t hits;
+    static uint32_t misses;
+    static uint32_t evictions;
+
+    static const FontEntry* findFont(const uint8_t *font);
+};
+
+// A string rendered once in one font, redrawn as a single blit
+class TextLayout {
+public:
+    TextLayout();
+
+    // Lay out and render text. Unchanged text and font are a no-op.
+    // Returns false (and leaves the layout invalid) if the text is longer
+    // than TEXT_LAYOUT_MAX_CHARS, wider than the screen, or the font is
+    // not cacheable.
+    bool set(const char *text, const uint8_t *font);
+    void invalidate() { valid = false; }
+
+    bool isValid() const { return valid; }
+    bool matches(const char *text, const uint8_t *font) const;
+    uint16_t getWidth() const { return width; }
+    const FontMetrics& getMetrics() const { return metrics; }
+    uint8_t getHeight() const { return (uint8_t)(metrics.ascent - metrics.descent); }
+    uint8_t getColumns() const { return columns; }
+    const uint8_t* getBitmap() const { return bits; }   // getColumns() bytes per band
+
+private:
+    const uint8_t *font;
+    char text[TEXT_LAYOUT_MAX_CHARS + 1];
+    uint16_t width;
+    uint8_t columns;        // Bitmap width (> width when the last glyph overhangs)
+    FontMetrics metrics;
+    bool valid;
+    uint8_t bits[DISPLAY_WIDTH * GLYPH_PAGES];
+};
+
+#endif // IONOS_GLYPH_CACHE_H
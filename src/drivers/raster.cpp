@@ -0,0 +1,375 @@
+#include "raster.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// ionOS v1.0 - 1-BIT RASTER ENGINE IMPLEMENTATION
+// ============================================================================
+
+// Static member initialization
+uint8_t *Raster::target = nullptr;
+int16_t Raster::clip_x0 = 0;
+int16_t Raster::clip_y0 = 0;
+int16_t Raster::clip_x1 = DISPLAY_WIDTH;
+int16_t Raster::clip_y1 = DISPLAY_HEIGHT;
+
+static const int16_t RASTER_PAGES = DISPLAY_HEIGHT / 8;
+static const uint16_t RASTER_BYTES = DISPLAY_WIDTH * DISPLAY_HEIGHT / 8;
+
+static inline int16_t clampTo(int32_t v, int16_t lo, int16_t hi) {
+    return v < lo ? lo : (v > hi ? hi : (int16_t)v);
+}
+
+// Combine source bits s into d; m marks the pixels the source covers.
+// Fills pass s == m, which makes RASTER_AND a no-op.
+template <RasterOp OP, typename T>
+static inline T rop(T d, T s, T m) {
+    switch (OP) {
+        case RASTER_OR:    return (T)(d | s);
+        case RASTER_CLEAR: return (T)(d & ~s);
+        case RASTER_XOR:   return (T)(d ^ s);
+        default:           return (T)(d & (s | ~m));
+    }
+}
+
+// Same mask in count consecutive column bytes, a word at a time in the middle
+template <RasterOp OP>
+static void spanWith(uint8_t *p, int16_t count, uint8_t mask) {
+    while (count > 0 && ((uintptr_t)p & 3) != 0) {
+        *p = rop<OP, uint8_t>(*p, mask, mask);
+        p++;
+        count--;
+    }
+
+    const uint32_t wide = mask * 0x01010101UL;
+    for (; count >= 4; count -= 4, p += 4) {
+        uint32_t word;
+        memcpy(&word, p, 4);
+        word = rop<OP, uint32_t>(word, wide, wide);
+        memcpy(p, &word, 4);
+    }
+
+    while (count-- > 0) {
+        *p = rop<OP, uint8_t>(*p, mask, mask);
+        p++;
+    }
+}
+
+// One band of bitmap bytes into one page: each source byte is shifted up
+// by `shift` bits, the low `down` bits dropped (0 for the page the band
+// starts in, 8 for the page below) and masked to the visible rows
+template <RasterOp OP>
+static void blitRow(uint8_t *dst, const uint8_t *src, int16_t count,
+                    uint8_t shift, uint8_t down, uint8_t mask) {
+    if (shift == 0) {
+        // Band sits on a page boundary: byte for byte
+        for (int16_t i = 0; i < count; i++) {
+            dst[i] = rop<OP, uint8_t>(dst[i], (uint8_t)(src[i] & mask), mask);
+        }
+        return;
+    }
+    for (int16_t i = 0; i < count; i++) {
+        uint8_t s = (uint8_t)(((uint16_t)src[i] << shift) >> down) & mask;
+        dst[i] = rop<OP, uint8_t>(dst[i], s, mask);
+    }
+}
+
+static void blitRowOp(uint8_t *dst, const uint8_t *src, int16_t count,
+                      uint8_t shift, uint8_t down, uint8_t mask, RasterOp op) {
+    switch (op) {
+        case RASTER_OR:    blitRow<RASTER_OR>(dst, src, count, shift, down, mask); break;
+        case RASTER_CLEAR: blitRow<RASTER_CLEAR>(dst, src, count, shift, down, mask); break;
+        case RASTER_XOR:   blitRow<RASTER_XOR>(dst, src, count, shift, down, mask); break;
+        case RASTER_AND:   blitRow<RASTER_AND>(dst, src, count, shift, down, mask); break;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Target and clipping
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::setTarget(uint8_t *buffer) {
+    target = buffer;
+}
+
+void Raster::setClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+    clip_x0 = clampTo(x, 0, DISPLAY_WIDTH);
+    clip_y0 = clampTo(y, 0, DISPLAY_HEIGHT);
+    clip_x1 = clampTo((int32_t)x + (w > 0 ? w : 0), clip_x0, DISPLAY_WIDTH);
+    clip_y1 = clampTo((int32_t)y + (h > 0 ? h : 0), clip_y0, DISPLAY_HEIGHT);
+}
+
+void Raster::resetClip() {
+    clip_x0 = 0;
+    clip_y0 = 0;
+    clip_x1 = DISPLAY_WIDTH;
+    clip_y1 = DISPLAY_HEIGHT;
+}
+
+bool Raster::contains(int16_t x, int16_t y, int16_t w, int16_t h) {
+    return x >= clip_x0 && y >= clip_y0 &&
+           (int32_t)x + w <= clip_x1 && (int32_t)y + h <= clip_y1;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Bits of one page covered by rows [y0, y1)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint8_t Raster::rowMask(int16_t page, int16_t y0, int16_t y1) {
+    int16_t lo = y0 - page * 8;
+    int16_t hi = y1 - page * 8;
+    if (lo < 0) lo = 0;
+    if (hi > 8) hi = 8;
+    if (hi <= lo) return 0;
+    return (uint8_t)(((1U << hi) - 1) & ~((1U << lo) - 1));
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Apply one row mask to a run of column bytes
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::span(uint8_t *row, int16_t count, uint8_t mask, RasterOp op) {
+    switch (op) {
+        case RASTER_OR:    spanWith<RASTER_OR>(row, count, mask); break;
+        case RASTER_CLEAR: spanWith<RASTER_CLEAR>(row, count, mask); break;
+        case RASTER_XOR:   spanWith<RASTER_XOR>(row, count, mask); break;
+        case RASTER_AND:   break;  // A solid source keeps every pixel
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Clear the whole target (ignores the clip, like clearBuffer())
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::clear() {
+    if (target == nullptr) return;
+    memset(target, 0, RASTER_BYTES);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Single pixel
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::pixel(int16_t x, int16_t y, RasterOp op) {
+    if (target == nullptr) return;
+    if (x < clip_x0 || x >= clip_x1 || y < clip_y0 || y >= clip_y1) return;
+
+    uint8_t *cell = &target[(y >> 3) * DISPLAY_WIDTH + x];
+    uint8_t bit = (uint8_t)(1 << (y & 7));
+    switch (op) {
+        case RASTER_OR:    *cell |= bit; break;
+        case RASTER_CLEAR: *cell &= ~bit; break;
+        case RASTER_XOR:   *cell ^= bit; break;
+        case RASTER_AND:   break;
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Spans
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::hLine(int16_t x, int16_t y, int16_t w, RasterOp op) {
+    fillRect(x, y, w, 1, op);
+}
+
+void Raster::vLine(int16_t x, int16_t y, int16_t h, RasterOp op) {
+    fillRect(x, y, 1, h, op);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Filled rectangle: one masked span per page
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, RasterOp op) {
+    if (target == nullptr || w <= 0 || h <= 0) return;
+
+    int16_t x0 = clampTo(x, clip_x0, clip_x1);
+    int16_t y0 = clampTo(y, clip_y0, clip_y1);
+    int16_t x1 = clampTo((int32_t)x + w, clip_x0, clip_x1);
+    int16_t y1 = clampTo((int32_t)y + h, clip_y0, clip_y1);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int16_t page = y0 >> 3; page <= (y1 - 1) >> 3; page++) {
+        span(target + page * DISPLAY_WIDTH + x0, x1 - x0, rowMask(page, y0, y1), op);
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Rectangle outline (same edges as U8g2 drawFrame, so XOR hits each pixel once)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::frame(int16_t x, int16_t y, int16_t w, int16_t h, RasterOp op) {
+    if (w <= 0 || h <= 0) return;
+    hLine(x, y, w, op);
+    if (h > 1) hLine(x, y + h - 1, w, op);
+    if (h > 2) {
+        vLine(x, y + 1, h - 2, op);
+        if (w > 1) vLine(x + w - 1, y + 1, h - 2, op);
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Line (Bresenham; axis-aligned lines become spans)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, RasterOp op) {
+    if (target == nullptr) return;
+
+    if (y1 == y2) {
+        hLine(x1 < x2 ? x1 : x2, y1, abs(x2 - x1) + 1, op);
+        return;
+    }
+    if (x1 == x2) {
+        vLine(x1, y1 < y2 ? y1 : y2, abs(y2 - y1) + 1, op);
+        return;
+    }
+
+    int16_t dx = abs(x2 - x1);
+    int16_t dy = -abs(y2 - y1);
+    int16_t sx = x1 < x2 ? 1 : -1;
+    int16_t sy = y1 < y2 ? 1 : -1;
+    int16_t err = dx + dy;
+
+    while (true) {
+        pixel(x1, y1, op);
+        if (x1 == x2 && y1 == y2) break;
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x1 += sx; }
+        if (e2 <= dx) { err += dx; y1 += sy; }
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Circle or disc (midpoint, same pixels as U8g2 drawCircle/drawDisc)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::circle(int16_t x0, int16_t y0, int16_t radius, bool fill, RasterOp op) {
+    if (target == nullptr || radius < 0) return;
+
+    // Discs are gathered into one vertical extent per screen column and
+    // drawn as spans afterwards, so overlapping sections are not drawn twice
+    int16_t extent[DISPLAY_WIDTH];
+    if (fill) {
+        for (int16_t col = 0; col < DISPLAY_WIDTH; col++) extent[col] = -1;
+    }
+
+    int16_t f = 1 - radius;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * radius;
+    int16_t x = 0;
+    int16_t y = radius;
+
+    while (true) {
+        if (fill) {
+            // Column x0 +- a reaches b rows above and below the centre
+            const int16_t pairs[2][2] = { { x, y }, { y, x } };
+            for (uint8_t i = 0; i < 2; i++) {
+                int16_t a = pairs[i][0];
+                int16_t b = pairs[i][1];
+                int16_t cols[2] = { (int16_t)(x0 + a), (int16_t)(x0 - a) };
+                for (uint8_t j = 0; j < 2; j++) {
+                    if (cols[j] >= 0 && cols[j] < DISPLAY_WIDTH && extent[cols[j]] < b) {
+                        extent[cols[j]] = b;
+                    }
+                }
+            }
+        } else if (x <= y) {
+            // Octant points, skipping the ones that coincide on the axes
+            // and the diagonal
+            const int16_t pairs[2][2] = { { x, y }, { y, x } };
+            for (uint8_t i = 0; i < (x == y ? 1 : 2); i++) {
+                int16_t a = pairs[i][0];
+                int16_t b = pairs[i][1];
+                pixel(x0 + a, y0 - b, op);
+                if (a != 0) pixel(x0 - a, y0 - b, op);
+                if (b != 0) pixel(x0 + a, y0 + b, op);
+                if (a != 0 && b != 0) pixel(x0 - a, y0 + b, op);
+            }
+        }
+
+        if (x >= y) break;
+        if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+    }
+
+    if (fill) {
+        for (int16_t col = 0; col < DISPLAY_WIDTH; col++) {
+            if (extent[col] >= 0) {
+                vLine(col, y0 - extent[col], 2 * extent[col] + 1, op);
+            }
+        }
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Page-major bitmap
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::blit(int16_t x, int16_t y, const uint8_t *bitmap,
+                  int16_t w, int16_t h, RasterOp op) {
+    if (target == nullptr || bitmap == nullptr || w <= 0 || h <= 0) return;
+
+    int16_t x0 = clampTo(x, clip_x0, clip_x1);
+    int16_t x1 = clampTo((int32_t)x + w, clip_x0, clip_x1);
+    int16_t y0 = clampTo(y, clip_y0, clip_y1);
+    int16_t y1 = clampTo((int32_t)y + h, clip_y0, clip_y1);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    const uint8_t shift = (uint8_t)(y & 7);
+    const int16_t bands = (h + 7) / 8;
+
+    for (int16_t band = 0; band < bands; band++) {
+        int16_t rows = h - band * 8;
+        uint8_t valid = rows >= 8 ? 0xFF : (uint8_t)((1 << rows) - 1);
+        const uint8_t *src = bitmap + band * w + (x0 - x);
+        int16_t page = (int16_t)((y + band * 8) >> 3);
+
+        // Upper part of the band lands in `page`, the rest in the page below
+        if (page >= 0 && page < RASTER_PAGES) {
+            uint8_t mask = (uint8_t)(valid << shift) & rowMask(page, y0, y1);
+            if (mask != 0) {
+                blitRowOp(target + page * DISPLAY_WIDTH + x0, src, x1 - x0, shift, 0, mask, op);
+            }
+        }
+        if (shift != 0 && page + 1 >= 0 && page + 1 < RASTER_PAGES) {
+            uint8_t mask = (uint8_t)(((uint16_t)valid << shift) >> 8) & rowMask(page + 1, y0, y1);
+            if (mask != 0) {
+                blitRowOp(target + (page + 1) * DISPLAY_WIDTH + x0, src, x1 - x0, shift, 8, mask, op);
+            }
+        }
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Page-aligned masked bands (no shifting)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Raster::blitMasked(int16_t x, int16_t page, const uint8_t *bits,
+                        const uint8_t *mask, int16_t w, int16_t pages) {
+    if (target == nullptr || bits == nullptr || w <= 0 || pages <= 0) return;
+    if (clip_y0 >= clip_y1) return;
+
+    int16_t x0 = clampTo(x, clip_x0, clip_x1);
+    int16_t x1 = clampTo((int32_t)x + w, clip_x0, clip_x1);
+    if (x0 >= x1) return;
+
+    int16_t first = page > (clip_y0 >> 3) ? page : (clip_y0 >> 3);
+    int16_t last = page + pages - 1;
+    if (last > (clip_y1 - 1) >> 3) last = (clip_y1 - 1) >> 3;
+
+    const int16_t count = x1 - x0;
+    for (int16_t p = first; p <= last; p++) {
+        const uint8_t *b = bits + (p - page) * w + (x0 - x);
+        uint8_t *d = target + p * DISPLAY_WIDTH + x0;
+        uint8_t clip = rowMask(p, clip_y0, clip_y1);
+
+        if (mask == nullptr) {
+            for (int16_t i = 0; i < count; i++) {
+                d[i] |= b[i] & clip;
+            }
+            continue;
+        }
+
+        const uint8_t *m = mask + (p - page) * w + (x0 - x);
+        if (clip == 0xFF) {
+            for (int16_t i = 0; i < count; i++) {
+                d[i] = (uint8_t)((d[i] & ~m[i]) | b[i]);
+            }
+        } else {
+            for (int16_t i = 0; i < count; i++) {
+                uint8_t mm = m[i] & clip;
+                d[i] = (uint8_t)((d[i] & ~mm) | (b[i] & mm));
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef IONOS_RASTER_H
+#define IONOS_RASTER_H
+
+#include <stdint.h>
+#include "../config/system_config.h"
+
+// ============================================================================
+// ionOS v1.0 - 1-BIT RASTER ENGINE
+// Draws straight into the SSD1306 page-major frame buffer that U8g2 ships:
+// byte (y / 8) * DISPLAY_WIDTH + x holds column x of page y / 8, with row
+// y % 8 in bit y % 8. A horizontal span is therefore one bit in a run of
+// bytes, filled a 32-bit word at a time; a vertical span is at most one
+// masked byte per page. Every call is clipped to the clip rectangle.
+// ============================================================================
+
+// How source pixels combine with the frame buffer
+enum RasterOp {
+    RASTER_OR = 0,      // Set pixels
+    RASTER_CLEAR = 1,   // Clear pixels
+    RASTER_XOR = 2,     // Invert pixels
+    RASTER_AND = 3      // Keep only pixels that are also set in the source
+};
+
+class Raster {
+public:
+    // Frame buffer to draw into (DISPLAY_WIDTH * DISPLAY_HEIGHT / 8 bytes).
+    // With no target every call is a no-op.
+    static void setTarget(uint8_t *buffer);
+    static uint8_t* getTarget() { return target; }
+
+    // Clipping (clamped to the screen; an empty rectangle hides everything)
+    static void setClip(int16_t x, int16_t y, int16_t w, int16_t h);
+    static void resetClip();
+    static bool contains(int16_t x, int16_t y, int16_t w, int16_t h);   // Box wholly inside the clip
+
+    // Primitives
+    static void clear();
+    static void pixel(int16_t x, int16_t y, RasterOp op);
+    static void hLine(int16_t x, int16_t y, int16_t w, RasterOp op);
+    static void vLine(int16_t x, int16_t y, int16_t h, RasterOp op);
+    static void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, RasterOp op);
+    static void frame(int16_t x, int16_t y, int16_t w, int16_t h, RasterOp op);
+    static void line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, RasterOp op);
+    static void circle(int16_t x0, int16_t y0, int16_t radius, bool fill, RasterOp op);
+
+    // Page-major 1-bit bitmap (same layout as the frame buffer: w bytes per
+    // 8-row band, bit 0 at the top). Bands landing on a page boundary are
+    // combined byte for byte; others are shifted across two pages.
+    static void blit(int16_t x, int16_t y, const uint8_t *bitmap,
+                     int16_t w, int16_t h, RasterOp op);
+
+    // Masked blit of bands that already start on page `page` (pre-shifted
+    // sprites): pixels under the mask take the image value, the rest are
+    // left alone. The image must not have bits outside the mask; with no
+    // mask the image is ORed in.
+    static void blitMasked(int16_t x, int16_t page, const uint8_t *bits,
+                           const uint8_t *mask, int16_t w, int16_t pages);
+
+private:
+    static uint8_t *target;
+    static int16_t clip_x0, clip_y0;    // Inclusive
+    static int16_t clip_x1, clip_y1;    // Exclusive
+
+    static void span(uint8_t *row, int16_t count, uint8_t mask, RasterOp op);
+    static uint8_t rowMask(int16_t page, int16_t y0, int16_t y1);
+};
+
+#endif // IONOS_RASTER_H
@@ -2,6 +2,9 @@
 #include "../config/pinmap.h"
 #include "../config/system_config.h"
 #include <Wire.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
 
 // ============================================================================
 // ionOS v1.0 - RTC DRIVER IMPLEMENTATION
@@ -28,6 +31,27 @@
 
 // Static member initialization
 bool RTCDriver::initialized = false;
+time_t RTCDriver::soft_base = 0;
+uint32_t RTCDriver::soft_base_ms = 0;
+
+// Firmware build time: a better software clock start than 2000-01-01
+static time_t buildTime() {
+    static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    char month[4] = { 0 };
+    int day = 1, year = 2000, hour = 0, minute = 0, second = 0;
+    sscanf(__DATE__, "%3s %d %d", month, &day, &year);
+    sscanf(__TIME__, "%d:%d:%d", &hour, &minute, &second);
+
+    const char *found = strstr(months, month);
+    struct tm tm_info = {};
+    tm_info.tm_year = year - 1900;
+    tm_info.tm_mon = found ? (found - months) / 3 : 0;
+    tm_info.tm_mday = day;
+    tm_info.tm_hour = hour;
+    tm_info.tm_min = minute;
+    tm_info.tm_sec = second;
+    return mktime(&tm_info);
+}
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Initialize RTC
@@ -41,11 +65,16 @@ bool RTCDriver::init() {
     Wire.begin(RTC_SDA, RTC_SCL, RTC_I2C_FREQ);
 
     // Check if device responds
-    Wire.beginTransmission(RTC_I2C_ADDR);
+    Wire.beginTransmission(RTC_ADDR);
     uint8_t error = Wire.endTransmission();
     
     if (error != 0) {
-        Serial.printf("[RTC] I2C error: %d\n", error);
+        // Keep time in software until the chip answers
+        if (soft_base == 0) {
+            soft_base = buildTime();
+            soft_base_ms = millis();
+        }
+        Serial.printf("[RTC] I2C error: %d, using software clock\n", error);
         return false;
     }
 
@@ -90,7 +119,7 @@ uint8_t RTCDriver::bcdToDec(uint8_t val) {
 // Write single register
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool RTCDriver::writeRegister(uint8_t reg, uint8_t value) {
-    Wire.beginTransmission(RTC_I2C_ADDR);
+    Wire.beginTransmission(RTC_ADDR);
     Wire.write(reg);
     Wire.write(value);
     return Wire.endTransmission() == 0;
@@ -100,11 +129,11 @@ bool RTCDriver::writeRegister(uint8_t reg, uint8_t value) {
 // Read single register
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 uint8_t RTCDriver::readRegister(uint8_t reg) {
-    Wire.beginTransmission(RTC_I2C_ADDR);
+    Wire.beginTransmission(RTC_ADDR);
     Wire.write(reg);
     Wire.endTransmission(false);
     
-    Wire.requestFrom(RTC_I2C_ADDR, (uint8_t)1, true);
+    Wire.requestFrom(RTC_ADDR, (uint8_t)1, true);
     if (Wire.available()) {
         return Wire.read();
     }
@@ -115,11 +144,11 @@ uint8_t RTCDriver::readRegister(uint8_t reg) {
 // Read multiple registers
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void RTCDriver::readRegisters(uint8_t start_reg, uint8_t *data, uint8_t len) {
-    Wire.beginTransmission(RTC_I2C_ADDR);
+    Wire.beginTransmission(RTC_ADDR);
     Wire.write(start_reg);
     Wire.endTransmission(false);
     
-    Wire.requestFrom(RTC_I2C_ADDR, len, true);
+    Wire.requestFrom(RTC_ADDR, len, true);
     for (int i = 0; i < len && Wire.available(); i++) {
         data[i] = Wire.read();
     }
@@ -129,6 +158,12 @@ void RTCDriver::readRegisters(uint8_t start_reg, uint8_t *data, uint8_t len) {
 // Get current time from RTC
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void RTCDriver::getTime(DateTime &dt) {
+    if (!initialized) {
+        // millis() wraps after ~49 days; setTime() re-anchors the clock
+        fromUnix(soft_base + (millis() - soft_base_ms) / 1000, dt);
+        return;
+    }
+
     uint8_t data[7];
     readRegisters(RTC_SECONDS, data, 7);
 
@@ -145,6 +180,12 @@ void RTCDriver::getTime(DateTime &dt) {
 // Set time in RTC
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void RTCDriver::setTime(const DateTime &dt) {
+    if (!initialized) {
+        soft_base = toUnix(dt);
+        soft_base_ms = millis();
+        return;
+    }
+
     writeRegister(RTC_SECONDS, decToBcd(dt.second));
     writeRegister(RTC_MINUTES, decToBcd(dt.minute));
     writeRegister(RTC_HOURS, decToBcd(dt.hour));
@@ -160,9 +201,15 @@ void RTCDriver::setTime(const DateTime &dt) {
 time_t RTCDriver::getUnixTime() {
     DateTime dt;
     getTime(dt);
-    
+    return toUnix(dt);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// DateTime -> Unix time
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+time_t RTCDriver::toUnix(const DateTime &dt) {
     // Simple conversion (doesn't account for all edge cases)
-    struct tm tm_info = {0};
+    struct tm tm_info = {};
     tm_info.tm_year = dt.year - 1900;
     tm_info.tm_mon = dt.month - 1;
     tm_info.tm_mday = dt.day;
@@ -178,24 +225,33 @@ time_t RTCDriver::getUnixTime() {
 // Set time from Unix timestamp
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void RTCDriver::setUnixTime(time_t unix_time) {
-    struct tm *tm_info = localtime(&unix_time);
-    
     DateTime dt;
-    dt.year = tm_info->tm_year + 1900;
-    dt.month = tm_info->tm_mon + 1;
-    dt.day = tm_info->tm_mday;
-    dt.hour = tm_info->tm_hour;
-    dt.minute = tm_info->tm_min;
-    dt.second = tm_info->tm_sec;
-    dt.dow = tm_info->tm_wday;
-    
+    fromUnix(unix_time, dt);
     setTime(dt);
 }
 
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Unix time -> DateTime
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void RTCDriver::fromUnix(time_t unix_time, DateTime &dt) {
+    struct tm tm_info;
+    localtime_r(&unix_time, &tm_info);
+
+    dt.year = tm_info.tm_year + 1900;
+    dt.month = tm_info.tm_mon + 1;
+    dt.day = tm_info.tm_mday;
+    dt.hour = tm_info.tm_hour;
+    dt.minute = tm_info.tm_min;
+    dt.second = tm_info.tm_sec;
+    dt.dow = tm_info.tm_wday;
+}
+
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Set Alarm 1
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void RTCDriver::setAlarm1(uint8_t hour, uint8_t minute) {
+    if (!initialized) return;
+
     // Alarm 1 matches on hour and minute (seconds always match)
     writeRegister(RTC_ALARM1_SEC, 0x00);  // Match seconds = 0
     writeRegister(RTC_ALARM1_MIN, decToBcd(minute) & 0x7F);
@@ -207,6 +263,8 @@ void RTCDriver::setAlarm1(uint8_t hour, uint8_t minute) {
 // Check Alarm 1 flag
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool RTCDriver::checkAlarm1() {
+    if (!initialized) return false;
+
     uint8_t status = readRegister(RTC_STATUS);
     return (status & 0x01) != 0;
 }
@@ -215,6 +273,8 @@ bool RTCDriver::checkAlarm1() {
 // Get temperature from DS3231 sensor
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 float RTCDriver::getTemperature() {
+    if (!initialized) return NAN;
+
     uint8_t temp_high = readRegister(RTC_TEMP_HIGH);
     uint8_t temp_low = readRegister(RTC_TEMP_LOW);
     
@@ -249,7 +309,8 @@ void RTCDriver::printDebugInfo() {
     Serial.print("â•‘ Time: ");
     printTime(dt);
     Serial.printf("â•‘ Temperature: %.2fÂ°C\n", getTemperature());
-    Serial.printf("â•‘ I2C Address: 0x%02X\n", RTC_I2C_ADDR);
+    Serial.printf("â•‘ I2C Address: 0x%02X\n", RTC_ADDR);
+    Serial.printf("â•‘ Source: %s\n", initialized ? "DS3231" : "software clock (millis)");
     
     Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
 }
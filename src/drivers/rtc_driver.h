@@ -7,7 +7,10 @@
 
 // ============================================================================
 // ionOS v1.0 - RTC DRIVER (DS3231)
-// Real-time clock for accurate time tracking
+// Real-time clock for accurate time tracking. When the DS3231 does not
+// answer, time is kept by a millis()-based software clock (starting at the
+// firmware build time, or the last setTime()) until a later init() finds
+// the chip; the hardware time wins from then on.
 // ============================================================================
 
 struct DateTime {
@@ -23,9 +26,9 @@ struct DateTime {
 class RTCDriver {
 public:
     // Initialization
-    static bool init();
+    static bool init();                 // false = software clock in use
     static void shutdown();
-    static bool isInitialized();
+    static bool isInitialized();        // DS3231 present
 
     // Time reading/writing
     static void getTime(DateTime &dt);
@@ -37,7 +40,7 @@ public:
     static void setAlarm1(uint8_t hour, uint8_t minute);
     static bool checkAlarm1();
 
-    // Temperature reading (DS3231 has built-in temp sensor)
+    // Temperature reading (DS3231 has built-in temp sensor; NAN without it)
     static float getTemperature();
 
     // Debug
@@ -46,6 +49,8 @@ public:
 
 private:
     static bool initialized;
+    static time_t soft_base;            // Software clock: time at soft_base_ms
+    static uint32_t soft_base_ms;
     
     // I2C communication
     static bool writeRegister(uint8_t reg, uint8_t value);
@@ -55,6 +60,10 @@ private:
     // BCD conversion
     static uint8_t decToBcd(uint8_t val);
     static uint8_t bcdToDec(uint8_t val);
+
+    // DateTime <-> Unix time (local time, as mktime/localtime)
+    static time_t toUnix(const DateTime &dt);
+    static void fromUnix(time_t unix_time, DateTime &dt);
 };
 
 #endif // IONOS_RTC_DRIVER_H
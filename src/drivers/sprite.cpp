@@ -0,0 +1,158 @@
+#include "sprite.h"
+#include "raster.h"
+#include "display_driver.h"
+#include <Arduino.h>
+
+// ============================================================================
+// ionOS v1.0 - SPRITES IMPLEMENTATION
+// ============================================================================
+
+// Static member initialization
+SpriteBatch::Entry SpriteBatch::entries[SPRITE_BATCH_SIZE];
+uint8_t SpriteBatch::count = 0;
+
+static const uint8_t SPRITE_PAGES = DISPLAY_HEIGHT / 8;
+
+Sprite::Sprite() : width(0), height(0), bands(0), masked(false), data(nullptr) {}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Render the 8 y-shifted copies of image and mask
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+bool Sprite::build(const SpriteImage &image, uint8_t *storage, uint16_t capacity) {
+    data = nullptr;
+    if (image.bits == nullptr || storage == nullptr || image.width == 0 || image.height == 0) {
+        Serial.println("[SPRITE] Empty image");
+        return false;
+    }
+    uint16_t needed = storageSize(image.width, image.height);
+    if (capacity < needed) {
+        Serial.printf("[SPRITE] Needs %u bytes of storage, got %u\n", needed, capacity);
+        return false;
+    }
+
+    width = image.width;
+    height = image.height;
+    bands = bandCount(height);
+    masked = image.mask != nullptr;
+
+    const uint8_t src_bands = (height + 7) / 8;
+    const uint8_t last_rows = height - (src_bands - 1) * 8;
+    const uint8_t last_valid = last_rows >= 8 ? 0xFF : (uint8_t)((1 << last_rows) - 1);
+    const uint16_t copy = (uint16_t)bands * width;
+
+    // Source byte with rows below the image cleared; 0 outside the image
+    auto source = [&](const uint8_t *plane, int16_t band, uint8_t col) -> uint8_t {
+        if (band < 0 || band >= src_bands) return 0;
+        uint8_t value = plane[band * width + col];
+        return band == src_bands - 1 ? (uint8_t)(value & last_valid) : value;
+    };
+    const uint8_t *mask_plane = image.mask != nullptr ? image.mask : image.bits;
+
+    for (uint8_t shift = 0; shift < SHIFTS; shift++) {
+        uint8_t *img = storage + shift * 2 * copy;
+        uint8_t *msk = img + copy;
+        for (uint8_t band = 0; band < bands; band++) {
+            for (uint8_t col = 0; col < width; col++) {
+                // Band b takes its own rows pushed down plus the spill of band b - 1
+                uint8_t m = (uint8_t)(source(mask_plane, band, col) << shift);
+                uint8_t b = (uint8_t)(source(image.bits, band, col) << shift);
+                if (shift != 0) {
+                    m |= source(mask_plane, band - 1, col) >> (8 - shift);
+                    b |= source(image.bits, band - 1, col) >> (8 - shift);
+                }
+                msk[band * width + col] = m;
+                img[band * width + col] = b & m;
+            }
+        }
+    }
+
+    data = storage;
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Copy the matching pre-shifted copy into the pages it covers
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void Sprite::blitAt(int16_t x, int16_t y) const {
+    const uint8_t shift = (uint8_t)(y & 7);
+    const uint16_t copy = (uint16_t)bands * width;
+    const uint8_t *img = data + shift * 2 * copy;
+    Raster::blitMasked(x, y >> 3, img, masked ? img + copy : nullptr, width, (height + shift + 7) / 8);
+}
+
+void Sprite::draw(int16_t x, int16_t y) const {
+    if (data == nullptr) return;
+    blitAt(x, y);
+    DisplayDriver::markDrawn(x, y, width, height);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Batch: queue a frame's sprites
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void SpriteBatch::begin() {
+    count = 0;
+}
+
+bool SpriteBatch::add(const Sprite &sprite, int16_t x, int16_t y) {
+    if (!sprite.isReady()) return false;
+    if (count >= SPRITE_BATCH_SIZE) return false;
+    entries[count].sprite = &sprite;
+    entries[count].x = x;
+    entries[count].y = y;
+    count++;
+    return true;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Batch: draw everything queued, then mark it dirty
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void SpriteBatch::flush() {
+    uint8_t *target = Raster::getTarget();
+    uint16_t tiles[SPRITE_PAGES] = { 0 };
+
+    for (uint8_t i = 0; i < count; i++) {
+        const Entry &entry = entries[i];
+        const Sprite &sprite = *entry.sprite;
+
+        if (target == nullptr || !Raster::contains(entry.x, entry.y, sprite.width, sprite.height)) {
+            // Partly clipped: take the general path
+            sprite.blitAt(entry.x, entry.y);
+            DisplayDriver::markDrawn(entry.x, entry.y, sprite.width, sprite.height);
+            continue;
+        }
+
+        // Wholly visible: copy the bands straight in and collect the tiles
+        const uint8_t shift = (uint8_t)(entry.y & 7);
+        const uint8_t pages = (uint8_t)((sprite.height + shift + 7) / 8);
+        const uint8_t width = sprite.width;
+        const uint16_t copy = (uint16_t)sprite.bands * width;
+        const uint8_t *b = sprite.data + shift * 2 * copy;
+        const uint8_t *m = b + copy;
+        uint8_t *d = target + (entry.y >> 3) * DISPLAY_WIDTH + entry.x;
+
+        for (uint8_t p = 0; p < pages; p++) {
+            if (sprite.masked) {
+                for (uint8_t col = 0; col < width; col++) {
+                    d[col] = (uint8_t)((d[col] & ~m[col]) | b[col]);
+                }
+                m += width;
+            } else {
+                for (uint8_t col = 0; col < width; col++) {
+                    d[col] |= b[col];
+                }
+            }
+            b += width;
+            d += DISPLAY_WIDTH;
+        }
+
+        uint8_t first_tile = entry.x / 8;
+        uint8_t last_tile = (entry.x + width - 1) / 8;
+        uint16_t mask = (uint16_t)(((1UL << (last_tile + 1)) - 1) & ~((1UL << first_tile) - 1));
+        for (int16_t page = entry.y >> 3; page <= (entry.y + sprite.height - 1) >> 3; page++) {
+            tiles[page] |= mask;
+        }
+    }
+
+    DisplayDriver::markDrawnTiles(tiles);
+    count = 0;
+}
@@ -0,0 +1,95 @@
+#ifndef IONOS_SPRITE_H
+#define IONOS_SPRITE_H
+
+#include <stdint.h>
+#include "../config/system_config.h"
+
+// ============================================================================
+// ionOS v1.0 - SPRITES
+// Masked 1-bit sprites for games. The frame buffer is page-major (a byte
+// is 8 vertically stacked pixels), so the expensive sub-byte offset is the
+// y position, not x: build() renders 8 copies of the image and mask, one
+// per y % 8, and drawing becomes a byte-aligned masked copy into the pages
+// the sprite covers. Sprites without a mask are simply ORed in. A frame's
+// sprites can be queued in the SpriteBatch and drawn with one flush().
+// ============================================================================
+
+// Source art: page-major like the frame buffer (width bytes per 8-row
+// band, bit 0 = top row of the band)
+struct SpriteImage {
+    uint8_t width;
+    uint8_t height;
+    const uint8_t *bits;
+    const uint8_t *mask;    // Opaque pixels; nullptr = just the set bits
+};
+
+class Sprite {
+public:
+    static const uint8_t SHIFTS = 8;
+
+    // Bytes of pre-shifted image + mask data for a width x height sprite
+    static constexpr uint16_t storageSize(uint8_t width, uint8_t height) {
+        return (uint16_t)SHIFTS * 2 * bandCount(height) * width;
+    }
+
+    Sprite();
+
+    // Render the pre-shifted copies into storage (false if it is too small)
+    bool build(const SpriteImage &image, uint8_t *storage, uint16_t capacity);
+    bool isReady() const { return data != nullptr; }
+
+    // Draw now, top-left corner at (x, y)
+    void draw(int16_t x, int16_t y) const;
+
+    uint8_t getWidth() const { return width; }
+    uint8_t getHeight() const { return height; }
+
+private:
+    friend class SpriteBatch;
+
+    // Bands of a copy shifted down by up to 7 rows
+    static constexpr uint8_t bandCount(uint8_t height) {
+        return (uint8_t)((height + 14) / 8);
+    }
+
+    uint8_t width;
+    uint8_t height;
+    uint8_t bands;
+    bool masked;
+    uint8_t *data;      // SHIFTS x (image bands, mask bands), width bytes each
+
+    void blitAt(int16_t x, int16_t y) const;
+};
+
+// Sprite that carries its own storage
+template <uint8_t W, uint8_t H>
+class StaticSprite : public Sprite {
+public:
+    bool build(const SpriteImage &image) {
+        return Sprite::build(image, storage, sizeof(storage));
+    }
+
+private:
+    uint8_t storage[Sprite::storageSize(W, H)];
+};
+
+// One frame's sprites, drawn in queue order (later ones on top) by flush()
+class SpriteBatch {
+public:
+    static void begin();
+    static bool add(const Sprite &sprite, int16_t x, int16_t y);   // false when full
+    static void flush();
+    static uint8_t getCount() { return count; }
+
+private:
+    struct Entry {
+        const Sprite *sprite;
+        int16_t x;
+        int16_t y;
+    };
+
+    static Entry entries[SPRITE_BATCH_SIZE];
+    static uint8_t count;
+};
+
+#endif // IONOS_SPRITE_H
@@ -2,24 +2,48 @@
 #include "config/system_config.h"
 #include "config/version.h"
 #include "core/kernel.h"
+#include "core/boot_timeline.h"
 #include "drivers/display_driver.h"
+#include "drivers/button_driver.h"
+#include "drivers/battery_driver.h"
+#include "drivers/rtc_driver.h"
+#include "services/storage_service.h"
+#include "services/log_service.h"
+#include "services/settings_store.h"
+#include "services/time_service.h"
+#include "services/audio_service.h"
+#include "services/network_service.h"
+#include "apps/app_registry.h"
+#include "apps/settings_app.h"
+
+#ifdef IONOS_NATIVE
+#include <thread>
+#endif
 
 // ============================================================================
 // ionOS v1.0 - MAIN ENTRY POINT
 // ESP32-WROOM Firmware
 // ============================================================================
 
-// Forward declarations for apps
-class LauncherApp;
-extern LauncherApp launcher_app;
+// Debug console
+void handleSerialDebug();
+void printDebugHelp();
+void testDisplay();
+void testButtons();
+void testBattery();
+void testRTC();
+void testEventQueue(int producers);
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Setup (called once on boot)
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void setup() {
-    // Initialize serial for debug output
+    // Timestamps from here on are boot timeline stages
+    BootTimeline::init();
+
+    // Initialize serial for debug output (no settle delay: the UART can
+    // take output as soon as begin() returns, and boot time counts)
     Serial.begin(115200);
-    delay(100);
 
     // Print boot info
     Serial.println("\n\n");
@@ -41,11 +65,33 @@ void setup() {
         }
     }
 
+    // Services register their runner tasks, which the kernel only accepts
+    // before startup()
+    uint8_t stage = BootTimeline::begin("services");
+    // Volumes first: later services keep their files on them
+    bool services_ok = StorageService::init();
+    services_ok &= LogService::init();
+    services_ok &= SettingsStore::init();
+    services_ok &= TimeService::init();
+    services_ok &= AudioService::init();
+#if ENABLE_WIFI
+    services_ok &= NetworkService::init();
+#endif
+    BootTimeline::end(stage, services_ok);
+
+    // Saved brightness, volume and sleep timeout
+    SettingsApp::applySavedSettings();
+
+    // Start the event loop (tick() is a no-op until the kernel is running)
+    stage = BootTimeline::begin("startup");
+    BootTimeline::end(stage, Kernel::startup());
+
+    // Home screen; its first frame is drawn by the first tick
+    stage = BootTimeline::begin("launcher");
+    BootTimeline::end(stage, AppRegistry::launch(APP_ID_LAUNCHER));
+
     // All systems ready - print memory info
     Kernel::printMemoryInfo();
-
-    // Launch the launcher app (home screen)
-    // This will be implemented in launcher_app.cpp
     Serial.println("[MAIN] Setup complete, starting kernel loop...\n");
 }
 
@@ -64,8 +110,8 @@ void loop() {
     // Optional: Check for serial commands (debug console)
     handleSerialDebug();
 
-    // Yield to FreeRTOS scheduler
-    yield();
+    // Sleep until the next kernel task deadline (yields to FreeRTOS)
+    Kernel::waitForNextDeadline();
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
@@ -90,6 +136,15 @@ void handleSerialDebug() {
         Kernel::printDebugInfo();
     } else if (command == "mem") {
         Kernel::printMemoryInfo();
+    } else if (command == "tasks") {
+        Kernel::printTaskInfo();
+    } else if (command == "boot") {
+        BootTimeline::printReport();
+    } else if (command == "prof") {
+        Kernel::printPhaseStats();
+    } else if (command == "prof reset") {
+        Kernel::resetPhaseStats();
+        Serial.println("[DEBUG] Profiler reset");
     } else if (command == "help") {
         printDebugHelp();
     } else if (command == "restart") {
@@ -106,6 +161,9 @@ void handleSerialDebug() {
         testBattery();
     } else if (command == "test-rtc") {
         testRTC();
+    } else if (command.startsWith("test-events")) {
+        int producers = command.length() > 11 ? command.substring(11).toInt() : 4;
+        testEventQueue(producers > 0 ? producers : 4);
     } else {
         Serial.printf("[DEBUG] Unknown command: %s\n", command.c_str());
         Serial.println("[DEBUG] Type 'help' for commands");
@@ -124,10 +182,15 @@ void printDebugHelp() {
     Serial.println("â•‘ Commands:                           â•‘");
     Serial.println("â•‘  info ............... Show kernel info");
     Serial.println("â•‘  mem ................ Show memory info");
+    Serial.println("â•‘  tasks .............. Scheduler task table");
+    Serial.println("â•‘  boot ............... Boot timeline, TTFF/TTI");
+    Serial.println("â•‘  prof ............... Tick phase timings");
+    Serial.println("â•‘  prof reset ......... Clear tick timings");
     Serial.println("â•‘  test-display ....... Test display");
     Serial.println("â•‘  test-buttons ....... Test buttons");
     Serial.println("â•‘  test-battery ....... Test battery");
     Serial.println("â•‘  test-rtc ........... Test RTC");
+    Serial.println("â•‘  test-events [n] .... Event queue stress (n producers)");
     Serial.println("â•‘  sleep ............. Enter light sleep");
     Serial.println("â•‘  restart ............ Reboot device");
     Serial.println("â•‘  help .............. Show this help");
@@ -165,13 +228,13 @@ void testButtons() {
     while ((millis() - start) < 10000) {
         ButtonDriver::update();
         
-        for (int i = 0; i < 9; i++) {
-            ButtonEvent evt = ButtonDriver::getEvent((ButtonID)i);
-            if (evt != BTN_NONE) {
+        for (int i = 0; i < ButtonDriver::getButtonCount(); i++) {
+            ButtonEvent evt = ButtonDriver::getLastEvent(i);
+            if (evt != BTN_EVENT_NONE) {
                 const char *btn_names[] = {
-                    "UP", "DOWN", "LEFT", "RIGHT", "CENTER", "BACK", "MENU", "VOL_UP", "VOL_DOWN"
+                    "UP", "DOWN", "LEFT", "RIGHT", "SELECT", "BACK"
                 };
-                const char *evt_names[] = {"NONE", "SHORT", "LONG", "RELEASE", "REPEAT"};
+                const char *evt_names[] = {"NONE", "SHORT", "LONG", "RELEASE"};
                 Serial.printf("[TEST] Button %s: %s\n", btn_names[i], evt_names[evt]);
                 count++;
             }
@@ -208,8 +271,7 @@ void testRTC() {
     Serial.println("[TEST] Testing RTC...");
     
     if (!RTCDriver::isInitialized()) {
-        Serial.println("[TEST] RTC not initialized!");
-        return;
+        Serial.println("[TEST] RTC not present, showing the software clock");
     }
     
     DateTime now;
@@ -223,8 +285,122 @@ void testRTC() {
 }
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-// Forward includes for drivers (needed in this file)
+// Event queue stress test: N producers post while this loop consumes
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
-#include "drivers/button_driver.h"
-#include "drivers/battery_driver.h"
-#include "drivers/rtc_driver.h"
+struct StressProducer {
+    uint8_t id;
+    uint32_t posted;
+    std::atomic<bool> done;
+};
+
+static const uint8_t STRESS_MAX_PRODUCERS = 8;
+static const uint32_t STRESS_EVENTS_PER_PRODUCER = 50000;
+
+static void stressProducer(StressProducer *producer) {
+    for (uint32_t seq = 0; seq < STRESS_EVENTS_PER_PRODUCER; seq++) {
+        Event event = {
+            .type = EVENT_CUSTOM,
+            .priority = (EventPriority)(seq & 3),
+            .timestamp = 0,
+            .data1 = producer->id,
+            .data2 = 0,
+            .data3 = (void*)(uintptr_t)seq
+        };
+
+        // Retry on a full level (postEventFromISR never logs)
+        while (!EventQueue::postEventFromISR(event)) {
+            yield();
+        }
+        producer->posted++;
+    }
+    producer->done.store(true, std::memory_order_release);
+}
+
+#ifndef IONOS_NATIVE
+static void stressProducerTask(void *arg) {
+    stressProducer((StressProducer*)arg);
+    vTaskDelete(nullptr);
+}
+#endif
+
+void testEventQueue(int producers) {
+    static StressProducer stress[STRESS_MAX_PRODUCERS];
+    // Clamped while still an int: "test-events 260" must not wrap to 4
+    if (producers < 1) {
+        producers = 1;
+    } else if (producers > STRESS_MAX_PRODUCERS) {
+        producers = STRESS_MAX_PRODUCERS;
+    }
+
+    Serial.printf("[TEST] Event queue stress: %d producers x %u events\n",
+        producers, STRESS_EVENTS_PER_PRODUCER);
+    EventQueue::flush();
+
+    // Sequence numbers must arrive in order per producer and priority
+    int64_t last_seq[STRESS_MAX_PRODUCERS][4];
+    uint32_t received = 0;
+    uint32_t order_errors = 0;
+    uint32_t foreign = 0;
+    for (int i = 0; i < STRESS_MAX_PRODUCERS; i++) {
+        for (int p = 0; p < 4; p++) last_seq[i][p] = -1;
+    }
+
+    uint32_t start = micros();
+
+#ifdef IONOS_NATIVE
+    std::thread threads[STRESS_MAX_PRODUCERS];
+#endif
+    for (uint8_t i = 0; i < producers; i++) {
+        stress[i].id = i;
+        stress[i].posted = 0;
+        stress[i].done.store(false);
+#ifdef IONOS_NATIVE
+        threads[i] = std::thread(stressProducer, &stress[i]);
+#else
+        // Spread producers over both cores
+        xTaskCreatePinnedToCore(stressProducerTask, "ev_stress", STACK_SIZE_SMALL,
+                                &stress[i], 1, nullptr, i % 2);
+#endif
+    }
+
+    bool producing = true;
+    while (producing || !EventQueue::isEmpty()) {
+        producing = false;
+        for (uint8_t i = 0; i < producers; i++) {
+            if (!stress[i].done.load(std::memory_order_acquire)) producing = true;
+        }
+
+        Event event;
+        while (EventQueue::getEvent(event)) {
+            if (event.type != EVENT_CUSTOM || event.data1 >= producers) {
+                foreign++;
+                continue;
+            }
+            int64_t seq = (int64_t)(uintptr_t)event.data3;
+            if (seq <= last_seq[event.data1][event.priority]) {
+                order_errors++;
+            }
+            last_seq[event.data1][event.priority] = seq;
+            received++;
+        }
+        yield();
+    }
+
+#ifdef IONOS_NATIVE
+    for (uint8_t i = 0; i < producers; i++) {
+        threads[i].join();
+    }
+#endif
+
+    uint32_t elapsed = micros() - start;
+    uint32_t posted = 0;
+    for (uint8_t i = 0; i < producers; i++) {
+        posted += stress[i].posted;
+    }
+
+    Serial.printf("[TEST] Posted %u, received %u, order errors %u, foreign %u\n",
+        posted, received, order_errors, foreign);
+    Serial.printf("[TEST] %u us (%.2f us/event)\n", elapsed, posted ? (float)elapsed / posted : 0.0f);
+    Serial.println(posted == received && order_errors == 0 ?
+        "[TEST] Event queue stress PASSED" : "[TEST] Event queue stress FAILED");
+}
@@ -1,5 +1,7 @@
 #include "audio_service.h"
 #include <Arduino.h>
+#include "../core/kernel.h"
+#include <string.h>
 
 // ============================================================================
 // ionOS v1.0 - AUDIO SERVICE IMPLEMENTATION
@@ -7,7 +9,21 @@
 // ============================================================================
 
 uint8_t AudioService::current_volume = 128;
-bool AudioService::is_playing = false;
+std::atomic<bool> AudioService::is_playing(false);
+int8_t AudioService::task_id = -1;
+std::atomic<uint8_t> AudioService::pending_command(AudioService::AUDIO_CMD_NONE);
+char AudioService::pending_path[STORAGE_PATH_MAX] = {0};
+StorageHandle AudioService::stream = STORAGE_NO_HANDLE;
+ByteRing AudioService::ring;
+uint8_t AudioService::ring_storage[AUDIO_STREAM_BUFFER];
+uint32_t AudioService::byte_rate = 0;
+uint32_t AudioService::data_end = 0;
+uint32_t AudioService::played_bytes = 0;
+uint32_t AudioService::rate_credit = 0;
+uint32_t AudioService::last_update_ms = 0;
+
+// Longest gap update() catches up on (after a pause or a stalled runner)
+static const uint32_t AUDIO_MAX_CATCHUP_MS = 100;
 
 bool AudioService::init() {
     // Initialize I2S for audio output (MAX98357A)
@@ -15,6 +31,18 @@ bool AudioService::init() {
     
     Serial.println("[AUDIO] Audio service initialized");
     current_volume = 128;  // 50% volume
+
+    if (!ring.init(ring_storage, AUDIO_STREAM_BUFFER)) {
+        Serial.println("[AUDIO] AUDIO_STREAM_BUFFER must be a power of two");
+        return false;
+    }
+
+    // Playback refill runs on the stream runner, away from rendering
+    task_id = Kernel::registerTask("audio", update, AUDIO_UPDATE_INTERVAL_MS * 1000UL, false, RUNNER_STREAM);
+
+    // Stop the amplifier draw when the system sleeps or the battery is critical
+    Kernel::subscribe(EVENT_POWER_SLEEP, onPowerEvent);
+    Kernel::subscribe(EVENT_POWER_LOW_BATTERY, onPowerEvent);
     return true;
 }
 
@@ -24,8 +52,18 @@ void AudioService::shutdown() {
 }
 
 bool AudioService::play(const char *filepath) {
-    // TODO: Implement WAV/MP3 file playback from SD card
+    if (filepath == nullptr || strlen(filepath) >= STORAGE_PATH_MAX) {
+        Serial.println("[AUDIO] Invalid track path");
+        return false;
+    }
+
+    // The stream runner opens the file; don't hand it a half-written path
+    pending_command = AUDIO_CMD_NONE;
+    strcpy(pending_path, filepath);
+    pending_command = AUDIO_CMD_PLAY;
     is_playing = true;
+    if (task_id >= 0) Kernel::signalTask(task_id);
+
     Serial.printf("[AUDIO] Playing: %s\n", filepath);
     return true;
 }
@@ -44,6 +82,8 @@ bool AudioService::resume() {
 
 bool AudioService::stop() {
     is_playing = false;
+    pending_command = AUDIO_CMD_STOP;
+    if (task_id >= 0) Kernel::signalTask(task_id);
     Serial.println("[AUDIO] Stopped");
     return true;
 }
@@ -92,9 +132,119 @@ void AudioService::soundWarning() {
     beep(800, 100);
 }
 
+// Kernel loop: pause()/stop() only flip atomics and signal the stream runner
+void AudioService::onPowerEvent(const Event &event) {
+    if (!is_playing) return;
+
+    if (event.type == EVENT_POWER_SLEEP) {
+        pause();
+    } else {
+        stop();
+    }
+}
+
 void AudioService::update() {
-    // Update audio playback state
-    // TODO: Check if file is still playing, update position
+    // Track changes requested from the app side
+    uint8_t command = pending_command.exchange(AUDIO_CMD_NONE);
+    if (command == AUDIO_CMD_STOP) {
+        closeTrack();
+    } else if (command == AUDIO_CMD_PLAY) {
+        closeTrack();
+        if (!openTrack(pending_path)) is_playing = false;
+    }
+    if (stream == STORAGE_NO_HANDLE) return;
+
+    uint32_t now = millis();
+    uint32_t elapsed = now - last_update_ms;
+    last_update_ms = now;
+    if (!is_playing) return;
+    if (elapsed > AUDIO_MAX_CATCHUP_MS) elapsed = AUDIO_MAX_CATCHUP_MS;
+
+    // TODO: Hand the ring to i2s_write(); until the I2S output exists the
+    // samples are consumed at the file's byte rate
+    rate_credit += elapsed * byte_rate;
+    uint32_t due = rate_credit / 1000;
+    rate_credit %= 1000;
+    uint32_t buffered = ring.size();
+    uint32_t consumed = due < buffered ? due : buffered;
+    ring.consume(consumed);
+    played_bytes += consumed;
+
+    // Top the ring up from the card (sample data only, not trailing chunks)
+    uint32_t position = StorageService::tell(stream);
+    if (position < data_end) {
+        StorageService::readInto(stream, ring, data_end - position);
+    } else if (ring.isEmpty()) {
+        closeTrack();
+        is_playing = false;
+        Serial.println("[AUDIO] Track finished");
+    }
+}
+
+bool AudioService::openTrack(const char *filepath) {
+    stream = StorageService::openStream(filepath, STORAGE_MODE_READ);
+    if (stream == STORAGE_NO_HANDLE) {
+        Serial.printf("[AUDIO] Cannot open: %s\n", filepath);
+        return false;
+    }
+
+    // Raw PCM in the configured format unless a WAV header says otherwise
+    byte_rate = AUDIO_SAMPLE_RATE * AUDIO_CHANNELS * (AUDIO_BITS_PER_SAMPLE / 8);
+    data_end = StorageService::getStreamSize(stream);
+    findWavData();
+
+    ring.clear();
+    played_bytes = 0;
+    rate_credit = 0;
+    last_update_ms = millis();
+
+    // Prefill so the first I2S writes never wait on the card
+    uint32_t position = StorageService::tell(stream);
+    StorageService::readInto(stream, ring, data_end - position);
+    return true;
+}
+
+void AudioService::closeTrack() {
+    if (stream != STORAGE_NO_HANDLE) {
+        StorageService::closeStream(stream);
+        stream = STORAGE_NO_HANDLE;
+    }
+    ring.clear();
+}
+
+// Leave the stream at the first sample of a RIFF/WAVE file (and take its
+// byte rate and data length); anything else plays from the start
+void AudioService::findWavData() {
+    uint8_t header[16];
+    if (StorageService::read(stream, header, 12) != 12 ||
+        memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+        StorageService::seek(stream, 0);
+        return;
+    }
+
+    uint32_t file_size = data_end;
+    for (uint8_t chunks = 0; chunks < 16; chunks++) {
+        if (StorageService::read(stream, header, 8) != 8) break;
+
+        uint32_t chunk_size = header[4] | (header[5] << 8) | (header[6] << 16) | ((uint32_t)header[7] << 24);
+        uint32_t chunk_start = StorageService::tell(stream);
+
+        if (memcmp(header, "data", 4) == 0) {
+            if (chunk_size < file_size - chunk_start) data_end = chunk_start + chunk_size;
+            return;
+        }
+        if (memcmp(header, "fmt ", 4) == 0 && chunk_size >= 16 &&
+            StorageService::read(stream, header, 16) == 16) {
+            uint32_t rate = header[8] | (header[9] << 8) | (header[10] << 16) | ((uint32_t)header[11] << 24);
+            if (rate > 0) byte_rate = rate;
+        }
+
+        // Chunks are padded to an even size
+        if (!StorageService::seek(stream, chunk_start + chunk_size + (chunk_size & 1))) break;
+    }
+
+    // No data chunk: nothing to play
+    data_end = StorageService::tell(stream);
 }
 
 void AudioService::printDebugInfo() {
@@ -103,5 +253,7 @@ void AudioService::printDebugInfo() {
     Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
     Serial.printf("â•‘ Volume: %d/255 (%d%%)\n", current_volume, (current_volume * 100) / 255);
     Serial.printf("â•‘ Playing: %s\n", is_playing ? "YES" : "NO");
+    Serial.printf("â•‘ Stream: %lu bytes played, %lu/%lu buffered\n",
+        (unsigned long)played_bytes, (unsigned long)ring.size(), (unsigned long)ring.capacity());
     Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
 }
@@ -3,6 +3,10 @@
 
 #include <stdint.h>
 #include <Arduino.h>
+#include <atomic>
+#include "../core/events.h"
+#include "../core/byte_ring.h"
+#include "storage_service.h"
 
 // ============================================================================
 // ionOS v1.0 - AUDIO SERVICE
@@ -20,7 +24,7 @@ public:
     static bool init();
     static void shutdown();
 
-    // Playback control
+    // Playback control (the file is opened and streamed on the stream runner)
     static bool play(const char *filepath);
     static bool pause();
     static bool resume();
@@ -47,8 +51,34 @@ public:
     static void printDebugInfo();
 
 private:
+    // Requests from the app side, carried out by update()
+    enum AudioCommand {
+        AUDIO_CMD_NONE = 0,
+        AUDIO_CMD_PLAY = 1,
+        AUDIO_CMD_STOP = 2
+    };
+
     static uint8_t current_volume;
-    static bool is_playing;
+    static std::atomic<bool> is_playing;    // Kernel loop and stream runner
+    static int8_t task_id;
+
+    static std::atomic<uint8_t> pending_command;
+    static char pending_path[STORAGE_PATH_MAX];
+
+    // Current track: the file is streamed through the ring a refill at a time
+    static StorageHandle stream;
+    static ByteRing ring;
+    static uint8_t ring_storage[AUDIO_STREAM_BUFFER];
+    static uint32_t byte_rate;          // Bytes per second of sample data
+    static uint32_t data_end;           // File offset where the samples end
+    static uint32_t played_bytes;
+    static uint32_t rate_credit;        // Leftover byte_rate * ms
+    static uint32_t last_update_ms;
+
+    static void onPowerEvent(const Event &event);
+    static bool openTrack(const char *filepath);
+    static void closeTrack();
+    static void findWavData();
 };
 
 #endif // IONOS_AUDIO_SERVICE_H
@@ -1,274 +1,684 @@
 #include "log_service.h"
+#include "storage_service.h"
+#include "../core/kernel.h"
 #include <Arduino.h>
 #include <stdarg.h>
+#include <string.h>
 
 // ============================================================================
 // ionOS v1.0 - LOG SERVICE IMPLEMENTATION
 // System-wide logging with multiple log levels
+//
+// Callers only parse the format far enough to know each argument's type,
+// copy the arguments into a LogRecord and push it. The flush task walks
+// the same format again and hands each conversion to snprintf with the
+// stored value, so printf semantics are unchanged.
 // ============================================================================
 
-LogLevel LogService::current_level = LOG_INFO;
-bool LogService::serial_enabled = true;
-bool LogService::file_logging = false;
-char LogService::log_file[64] = "/logs/system.log";
-uint32_t LogService::total_logs = 0;
+static_assert(LOG_LINE_MAX <= LOG_BATCH_BYTES, "A log line must fit in one batch");
 
-// Color codes for serial output
+bool LogService::initialized = false;
+int8_t LogService::task_id = -1;
+volatile uint8_t LogService::current_level = LOG_INFO;
+bool LogService::file_logging_enabled = false;
+uint32_t LogService::file_size = 0;
+const char *LogService::tag_names[LOG_MAX_TAGS] = { "SYS" };
+uint8_t LogService::tag_count = 1;
+LogStats LogService::stats = { 0, 0, 0, 0, 0 };
+MpscRing<LogService::LogRecord, LOG_RING_SIZE> LogService::ring;
+std::atomic<bool> LogService::draining(false);
+
+// Color codes for serial output, by level
 static const char* LOG_COLORS[] = {
-    "\033[0;31m",   // RED - ERROR
-    "\033[0;33m",   // YELLOW - WARNING
-    "\033[0;32m",   // GREEN - INFO
     "\033[0;36m",   // CYAN - DEBUG
-    "\033[0;37m"    // WHITE - TRACE
+    "\033[0;32m",   // GREEN - INFO
+    "\033[0;33m",   // YELLOW - WARN
+    "\033[0;31m",   // RED - ERROR
+    "\033[1;31m"    // BOLD RED - CRITICAL
 };
 
 static const char* LOG_LEVEL_NAMES[] = {
-    "ERROR",
-    "WARNING",
-    "INFO",
     "DEBUG",
-    "TRACE"
+    "INFO",
+    "WARN",
+    "ERROR",
+    "CRIT"
 };
 
 static const char* LOG_RESET = "\033[0m";
 
-bool LogService::init() {
-    current_level = LOG_INFO;
-    serial_enabled = true;
-    file_logging = false;
-    total_logs = 0;
-    
-    Serial.println("[LOG] Log service initialized");
+// Flush task buffers (one consumer at a time)
+static char message[LOG_LINE_MAX];
+static char line[LOG_LINE_MAX];
+static char serial_batch[LOG_BATCH_BYTES];
+static char file_batch[LOG_BATCH_BYTES];
+static uint16_t serial_length = 0;
+static uint16_t file_length = 0;
+
+// Format parsing
+enum LogArgKind : uint8_t {
+    ARG_NONE,       // "%%"
+    ARG_INT,        // int and everything promoted to it (char, short, %c)
+    ARG_LONG,
+    ARG_LLONG,      // long long, intmax_t
+    ARG_SIZE,       // size_t, ptrdiff_t
+    ARG_DOUBLE,     // float and double
+    ARG_STRING,     // Copied into the record, NUL terminated
+    ARG_POINTER,
+    ARG_INVALID     // %n, long double, wide strings: stop here
+};
+
+struct LogFormatSpec {
+    const char *start;      // The '%'
+    const char *end;        // One past the conversion character
+    uint8_t stars;          // '*' width/precision ints before the value
+    LogArgKind kind;
+};
+
+static const uint8_t SPEC_TEXT_MAX = 16;
+
+static bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Parse the conversion starting at format ('%')
+static void parseSpec(const char *format, LogFormatSpec &spec) {
+    const char *p = format + 1;
+    spec.start = format;
+    spec.stars = 0;
+
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') p++;
+    if (*p == '*') {
+        spec.stars++;
+        p++;
+    } else {
+        while (isDigit(*p)) p++;
+    }
+    if (*p == '.') {
+        p++;
+        if (*p == '*') {
+            spec.stars++;
+            p++;
+        } else {
+            while (isDigit(*p)) p++;
+        }
+    }
+
+    uint8_t longs = 0;
+    char size = 0;
+    for (;; p++) {
+        if (*p == 'l') {
+            longs++;
+        } else if (*p == 'z' || *p == 't' || *p == 'j' || *p == 'L') {
+            size = *p;
+        } else if (*p != 'h') {
+            break;
+        }
+    }
+
+    char conversion = *p;
+    spec.end = conversion ? p + 1 : p;
+    switch (conversion) {
+        case '%':
+            spec.kind = ARG_NONE;
+            break;
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+            if (size == 'z' || size == 't') {
+                spec.kind = ARG_SIZE;
+            } else if (longs >= 2 || size == 'j') {
+                spec.kind = ARG_LLONG;
+            } else if (longs == 1) {
+                spec.kind = ARG_LONG;
+            } else {
+                spec.kind = ARG_INT;
+            }
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            spec.kind = (size == 'L') ? ARG_INVALID : ARG_DOUBLE;
+            break;
+        case 's':
+            spec.kind = longs ? ARG_INVALID : ARG_STRING;
+            break;
+        case 'p':
+            spec.kind = ARG_POINTER;
+            break;
+        default:
+            spec.kind = ARG_INVALID;
+            break;
+    }
+}
+
+static uint8_t argSize(LogArgKind kind) {
+    switch (kind) {
+        case ARG_INT: return sizeof(int);
+        case ARG_LONG: return sizeof(long);
+        case ARG_LLONG: return sizeof(long long);
+        case ARG_SIZE: return sizeof(size_t);
+        case ARG_DOUBLE: return sizeof(double);
+        case ARG_POINTER: return sizeof(void*);
+        default: return 0;
+    }
+}
+
+template <typename T>
+static int formatArg(char *out, size_t size, const char *spec, const int *stars, uint8_t star_count, T value) {
+    switch (star_count) {
+        case 0: return snprintf(out, size, spec, value);
+        case 1: return snprintf(out, size, spec, stars[0], value);
+        default: return snprintf(out, size, spec, stars[0], stars[1], value);
+    }
+}
+
+template <typename T>
+static T loadArg(const uint8_t *args, uint8_t &offset) {
+    T value;
+    memcpy(&value, args + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+bool LogService::init(LogLevel level) {
+    current_level = level;
+    tag_count = 1;
+    memset(&stats, 0, sizeof(stats));
+
+    // Keep appending to the existing log; the directory may not exist yet
+    char dir[STORAGE_PATH_MAX];
+    strncpy(dir, LOG_FILE_PATH, sizeof(dir) - 1);
+    dir[sizeof(dir) - 1] = '\0';
+    char *slash = strrchr(dir, '/');
+    if (slash != nullptr && slash != dir) {
+        *slash = '\0';
+        StorageService::createDir(dir);
+    }
+    file_size = StorageService::getFileSize(LOG_FILE_PATH);
+
+    // Formatting and writes happen on the service runner
+    if (task_id < 0) {
+        task_id = Kernel::registerTask("log", flushTask, LOG_FLUSH_INTERVAL_MS * 1000UL, false, RUNNER_SERVICE);
+        Kernel::subscribe(EVENT_POWER_SLEEP, onPowerEvent);
+    }
+    initialized = true;
+
+    Serial.printf("[LOG] Log service initialized (%s, %u record ring)\n",
+        levelToString(level), LOG_RING_SIZE);
     return true;
 }
 
 void LogService::shutdown() {
+    flush();
+    initialized = false;
     Serial.println("[LOG] Log service shutdown");
 }
 
 void LogService::setLogLevel(LogLevel level) {
     current_level = level;
-    Serial.printf("[LOG] Log level set to: %s\n", LOG_LEVEL_NAMES[level]);
+    Serial.printf("[LOG] Log level set to: %s\n", levelToString(level));
 }
 
 LogLevel LogService::getLogLevel() {
-    return current_level;
+    return (LogLevel)current_level;
 }
 
-void LogService::enableSerialOutput(bool enabled) {
-    serial_enabled = enabled;
+LogTag LogService::registerTag(const char *name) {
+    for (uint8_t i = 0; i < tag_count; i++) {
+        if (strcmp(tag_names[i], name) == 0) {
+            return i;
+        }
+    }
+    if (tag_count >= LOG_MAX_TAGS) {
+        Serial.printf("[LOG] Tag table full, %s logs as %s\n", name, tag_names[LOG_TAG_SYSTEM]);
+        return LOG_TAG_SYSTEM;
+    }
+    tag_names[tag_count] = name;
+    return tag_count++;
 }
 
-void LogService::enableFileLogging(bool enabled) {
-    file_logging = enabled;
-    if (enabled) {
-        Serial.printf("[LOG] File logging enabled: %s\n", log_file);
-    } else {
-        Serial.println("[LOG] File logging disabled");
-    }
+void LogService::debug(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    vlog(LOG_DEBUG, LOG_TAG_SYSTEM, format, args);
+    va_end(args);
 }
 
-void LogService::setLogFile(const char *filepath) {
-    strncpy(log_file, filepath, sizeof(log_file) - 1);
-    log_file[sizeof(log_file) - 1] = '\0';
+void LogService::info(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    vlog(LOG_INFO, LOG_TAG_SYSTEM, format, args);
+    va_end(args);
 }
 
-void LogService::logError(const char *tag, const char *format, ...) {
-    if (current_level < LOG_ERROR) return;
-    
+void LogService::warn(const char *format, ...) {
     va_list args;
     va_start(args, format);
-    logMessage(LOG_ERROR, tag, format, args);
+    vlog(LOG_WARN, LOG_TAG_SYSTEM, format, args);
     va_end(args);
 }
 
-void LogService::logWarning(const char *tag, const char *format, ...) {
-    if (current_level < LOG_WARNING) return;
-    
+void LogService::error(const char *format, ...) {
     va_list args;
     va_start(args, format);
-    logMessage(LOG_WARNING, tag, format, args);
+    vlog(LOG_ERROR, LOG_TAG_SYSTEM, format, args);
     va_end(args);
 }
 
-void LogService::logInfo(const char *tag, const char *format, ...) {
-    if (current_level < LOG_INFO) return;
-    
+void LogService::critical(const char *format, ...) {
     va_list args;
     va_start(args, format);
-    logMessage(LOG_INFO, tag, format, args);
+    vlog(LOG_CRITICAL, LOG_TAG_SYSTEM, format, args);
     va_end(args);
 }
 
-void LogService::logDebug(const char *tag, const char *format, ...) {
-    if (current_level < LOG_DEBUG) return;
-    
+void LogService::log(LogLevel level, const char *format, ...) {
     va_list args;
     va_start(args, format);
-    logMessage(LOG_DEBUG, tag, format, args);
+    vlog(level, LOG_TAG_SYSTEM, format, args);
     va_end(args);
 }
 
-void LogService::logTrace(const char *tag, const char *format, ...) {
-    if (current_level < LOG_TRACE) return;
-    
+void LogService::logTagged(LogLevel level, LogTag tag, const char *format, ...) {
     va_list args;
     va_start(args, format);
-    logMessage(LOG_TRACE, tag, format, args);
+    vlog(level, tag, format, args);
     va_end(args);
 }
 
-void LogService::logMessage(LogLevel level, const char *tag, const char *format, va_list args) {
-    total_logs++;
-    
-    // Format timestamp (simplified)
-    uint32_t millis_now = millis();
-    uint32_t seconds = millis_now / 1000;
-    uint32_t milliseconds = millis_now % 1000;
-    
-    // Build log message
-    char log_buffer[512];
-    char msg_buffer[256];
-    
-    // Format the actual message with va_args
-    vsnprintf(msg_buffer, sizeof(msg_buffer), format, args);
-    
-    if (serial_enabled) {
-        // Format for serial with colors
-        snprintf(log_buffer, sizeof(log_buffer),
-            "%s[%3lu.%03lu] [%-7s] [%s]%s %s\n",
-            LOG_COLORS[level],
-            seconds, milliseconds,
-            LOG_LEVEL_NAMES[level],
-            tag,
-            LOG_RESET,
-            msg_buffer);
-        
-        Serial.print(log_buffer);
+void LogService::vlog(LogLevel level, LogTag tag, const char *format, va_list args) {
+    if (level < current_level || format == nullptr) return;
+
+    LogRecord record;
+    record.timestamp_ms = millis();
+    record.format = format;
+    record.level = level;
+    record.tag = tag;
+    bool truncated;
+    record.arg_bytes = captureArgs(format, args, record.args, truncated);
+    record.truncated = truncated;
+    push(record);
+}
+
+void LogService::logRaw(const char *message) {
+    if (message == nullptr) return;
+
+    LogRecord record;
+    record.timestamp_ms = millis();
+    record.format = nullptr;
+    record.level = LOG_INFO;
+    record.tag = LOG_TAG_SYSTEM;
+    size_t length = strlen(message);
+    record.truncated = length > LOG_ARG_BYTES - 1;
+    if (record.truncated) length = LOG_ARG_BYTES - 1;
+    memcpy(record.args, message, length);
+    record.args[length] = '\0';
+    record.arg_bytes = length + 1;
+    push(record);
+}
+
+void LogService::push(LogRecord &record) {
+    if (!ring.push(record)) {
+        return;     // Counted by the ring, reported by the next flush
+    }
+
+    // No flush task before init() or after shutdown(): write it out now
+    if (!initialized) {
+        flush();
+        return;
     }
-    
-    if (file_logging) {
-        // Format for file (without colors)
-        snprintf(log_buffer, sizeof(log_buffer),
-            "[%3lu.%03lu] [%-7s] [%s] %s\n",
-            seconds, milliseconds,
-            LOG_LEVEL_NAMES[level],
-            tag,
-            msg_buffer);
-        
-        // TODO: Write to SD card using StorageService
-        // StorageService::appendFile(log_file, log_buffer);
+
+    // Running out of room: write out now instead of at the next period
+    if (task_id >= 0 && ring.size() >= LOG_RING_SIZE * 3 / 4) {
+        Kernel::signalTask(task_id);
     }
 }
 
-uint32_t LogService::getTotalLogCount() {
-    return total_logs;
+// Copy the arguments the format consumes; stops at the first one that
+// does not fit (strings are cut to the space left)
+uint8_t LogService::captureArgs(const char *format, va_list args, uint8_t *out, bool &truncated) {
+    uint8_t used = 0;
+    truncated = false;
+
+    for (const char *p = format; *p != '\0'; ) {
+        if (*p != '%') {
+            p++;
+            continue;
+        }
+
+        LogFormatSpec spec;
+        parseSpec(p, spec);
+        p = spec.end;
+        if (spec.kind == ARG_NONE) continue;
+        if (spec.kind == ARG_INVALID) break;
+
+        uint8_t star_bytes = spec.stars * sizeof(int);
+        uint8_t needed = star_bytes + (spec.kind == ARG_STRING ? 1 : argSize(spec.kind));
+        if (used + needed > LOG_ARG_BYTES) {
+            truncated = true;
+            break;
+        }
+
+        for (uint8_t i = 0; i < spec.stars; i++) {
+            int star = va_arg(args, int);
+            memcpy(out + used, &star, sizeof(star));
+            used += sizeof(star);
+        }
+
+        switch (spec.kind) {
+            case ARG_INT: {
+                int value = va_arg(args, int);
+                memcpy(out + used, &value, sizeof(value));
+                break;
+            }
+            case ARG_LONG: {
+                long value = va_arg(args, long);
+                memcpy(out + used, &value, sizeof(value));
+                break;
+            }
+            case ARG_LLONG: {
+                long long value = va_arg(args, long long);
+                memcpy(out + used, &value, sizeof(value));
+                break;
+            }
+            case ARG_SIZE: {
+                size_t value = va_arg(args, size_t);
+                memcpy(out + used, &value, sizeof(value));
+                break;
+            }
+            case ARG_DOUBLE: {
+                double value = va_arg(args, double);
+                memcpy(out + used, &value, sizeof(value));
+                break;
+            }
+            case ARG_POINTER: {
+                void *value = va_arg(args, void*);
+                memcpy(out + used, &value, sizeof(value));
+                break;
+            }
+            case ARG_STRING: {
+                const char *text = va_arg(args, const char*);
+                if (text == nullptr) text = "(null)";
+                size_t room = LOG_ARG_BYTES - used - 1;
+                size_t length = strnlen(text, room + 1);
+                if (length > room) {
+                    length = room;
+                    truncated = true;
+                }
+                memcpy(out + used, text, length);
+                out[used + length] = '\0';
+                used += length + 1;
+                continue;
+            }
+            default:
+                break;
+        }
+        used += argSize(spec.kind);
+    }
+    return used;
 }
 
-void LogService::clearLogs() {
-    total_logs = 0;
-    // TODO: Delete log file from SD card
-    Serial.println("[LOG] Logs cleared");
+// Render a record's message (no prefix or newline); returns its length
+uint16_t LogService::formatRecord(const LogRecord &record, char *out, uint16_t capacity) {
+    uint16_t length = 0;
+
+    if (record.format == nullptr) {
+        length = strnlen((const char*)record.args, record.arg_bytes);
+        if (length > capacity - 1) length = capacity - 1;
+        memcpy(out, record.args, length);
+        out[length] = '\0';
+        return length;
+    }
+
+    uint8_t offset = 0;
+    bool complete = true;
+    const char *p = record.format;
+    while (*p != '\0' && length < capacity - 1) {
+        if (*p != '%') {
+            out[length++] = *p++;
+            continue;
+        }
+
+        LogFormatSpec spec;
+        parseSpec(p, spec);
+        if (spec.kind == ARG_NONE) {
+            out[length++] = '%';
+            p = spec.end;
+            continue;
+        }
+
+        // Arguments that were not captured end the message
+        uint8_t star_bytes = spec.stars * sizeof(int);
+        uint8_t spec_length = spec.end - spec.start;
+        bool available = (spec.kind == ARG_STRING)
+            ? offset + star_bytes < record.arg_bytes
+            : offset + star_bytes + argSize(spec.kind) <= record.arg_bytes;
+        if (spec.kind == ARG_INVALID || !available || spec_length >= SPEC_TEXT_MAX) {
+            complete = false;
+            break;
+        }
+
+        char spec_text[SPEC_TEXT_MAX];
+        memcpy(spec_text, spec.start, spec_length);
+        spec_text[spec_length] = '\0';
+
+        int stars[2] = { 0, 0 };
+        for (uint8_t i = 0; i < spec.stars; i++) {
+            stars[i] = loadArg<int>(record.args, offset);
+        }
+
+        char *dest = out + length;
+        size_t room = capacity - length;
+        int written = 0;
+        switch (spec.kind) {
+            case ARG_INT:
+                written = formatArg(dest, room, spec_text, stars, spec.stars, loadArg<int>(record.args, offset));
+                break;
+            case ARG_LONG:
+                written = formatArg(dest, room, spec_text, stars, spec.stars, loadArg<long>(record.args, offset));
+                break;
+            case ARG_LLONG:
+                written = formatArg(dest, room, spec_text, stars, spec.stars, loadArg<long long>(record.args, offset));
+                break;
+            case ARG_SIZE:
+                written = formatArg(dest, room, spec_text, stars, spec.stars, loadArg<size_t>(record.args, offset));
+                break;
+            case ARG_DOUBLE:
+                written = formatArg(dest, room, spec_text, stars, spec.stars, loadArg<double>(record.args, offset));
+                break;
+            case ARG_POINTER:
+                written = formatArg(dest, room, spec_text, stars, spec.stars, loadArg<void*>(record.args, offset));
+                break;
+            case ARG_STRING: {
+                const char *text = (const char*)record.args + offset;
+                written = formatArg(dest, room, spec_text, stars, spec.stars, text);
+                offset += strnlen(text, record.arg_bytes - offset) + 1;
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (written > 0) {
+            length += ((size_t)written < room) ? written : room - 1;
+        }
+        p = spec.end;
+    }
+
+    if ((!complete || record.truncated) && length + 4 <= capacity - 1) {
+        memcpy(out + length, " ...", 4);
+        length += 4;
+    }
+    out[length] = '\0';
+    return length;
 }
 
-void LogService::printDebugInfo() {
-    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
-    Serial.println("â•‘  LOG SERVICE DEBUG INFO           â•‘");
-    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
-    Serial.printf("â•‘ Current Level: %s\n", LOG_LEVEL_NAMES[current_level]);
-    Serial.printf("â•‘ Serial Output: %s\n", serial_enabled ? "ENABLED" : "DISABLED");
-    Serial.printf("â•‘ File Logging: %s\n", file_logging ? "ENABLED" : "DISABLED");
-    Serial.printf("â•‘ Log File: %s\n", log_file);
-    Serial.printf("â•‘ Total Logs: %lu\n", total_logs);
-    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+void LogService::flushTask() {
+    flush();
 }
 
-void LogService::printBanner(const char *text) {
-    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
-    Serial.printf("â•‘ %s\n", text);
-    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+void LogService::onPowerEvent(const Event &event) {
+    (void)event;
+
+    // Get queued records out before the CPU stops
+    if (task_id >= 0) {
+        Kernel::signalTask(task_id);
+    }
 }
 
-void LogService::printSeparator() {
-    Serial.println("â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€");
+bool LogService::flush() {
+    if (draining.exchange(true)) return false;
+
+    while (drain() > 0) {
+    }
+
+    draining = false;
+    return true;
 }
 
-void LogService::printHexDump(const char *tag, const uint8_t *data, uint16_t length) {
-    Serial.printf("[%s] Hex Dump (%d bytes):\n", tag, length);
-    
-    for (uint16_t i = 0; i < length; i += 16) {
-        Serial.printf("%04X: ", i);
-        
-        // Print hex values
-        for (uint16_t j = 0; j < 16 && i + j < length; j++) {
-            Serial.printf("%02X ", data[i + j]);
+// Format up to one ring's worth of records into the batches and write
+// them out; the caller holds draining
+uint32_t LogService::drain() {
+    uint32_t count = 0;
+    LogRecord record;
+
+    while (count < LOG_RING_SIZE && ring.pop(record)) {
+        formatRecord(record, message, sizeof(message));
+
+        uint8_t level = record.level <= LOG_CRITICAL ? record.level : (uint8_t)LOG_CRITICAL;
+        const char *tag = record.tag < tag_count ? tag_names[record.tag] : "?";
+        uint32_t seconds = record.timestamp_ms / 1000;
+        uint32_t milliseconds = record.timestamp_ms % 1000;
+
+        int length = snprintf(line, sizeof(line), "%s[%3lu.%03lu] [%-5s] [%s]%s %s\n",
+            LOG_COLORS[level], (unsigned long)seconds, (unsigned long)milliseconds,
+            LOG_LEVEL_NAMES[level], tag, LOG_RESET, message);
+        if (length >= (int)sizeof(line)) {
+            length = sizeof(line) - 1;
+            line[length - 1] = '\n';
         }
-        
-        // Print ASCII representation
-        Serial.print("  ");
-        for (uint16_t j = 0; j < 16 && i + j < length; j++) {
-            uint8_t c = data[i + j];
-            if (c >= 32 && c <= 126) {
-                Serial.printf("%c", c);
-            } else {
-                Serial.print(".");
+        if (serial_length + length > LOG_BATCH_BYTES) {
+            logToSerial(serial_batch, serial_length);
+            serial_length = 0;
+        }
+        memcpy(serial_batch + serial_length, line, length);
+        serial_length += length;
+
+        if (file_logging_enabled) {
+            length = snprintf(line, sizeof(line), "[%3lu.%03lu] [%-5s] [%s] %s\n",
+                (unsigned long)seconds, (unsigned long)milliseconds,
+                LOG_LEVEL_NAMES[level], tag, message);
+            if (length >= (int)sizeof(line)) {
+                length = sizeof(line) - 1;
+                line[length - 1] = '\n';
+            }
+            if (file_length + length > LOG_BATCH_BYTES) {
+                logToFile(file_batch, file_length);
+                file_length = 0;
             }
+            memcpy(file_batch + file_length, line, length);
+            file_length += length;
         }
-        
-        Serial.println();
+
+        if (record.truncated) stats.truncated++;
+        count++;
+    }
+
+    uint32_t dropped = ring.getDropped();
+    if (dropped != stats.dropped) {
+        Serial.printf("[LOG] %lu records dropped (ring full)\n", (unsigned long)(dropped - stats.dropped));
+        stats.dropped = dropped;
+    }
+
+    if (serial_length > 0) {
+        logToSerial(serial_batch, serial_length);
+        serial_length = 0;
+    }
+    if (file_length > 0) {
+        logToFile(file_batch, file_length);
+        file_length = 0;
+    }
+
+    if (count > 0) {
+        stats.records += count;
+        stats.batches++;
     }
+    return count;
 }
 
-void LogService::printMemoryUsage() {
-    // ESP32-specific memory info
-    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
-    Serial.println("â•‘  MEMORY USAGE INFO                â•‘");
-    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
-    
-    // Get free heap
-    uint32_t free_heap = esp_get_free_heap_size();
-    uint32_t min_free_heap = esp_get_minimum_free_heap_size();
-    uint32_t total_heap = 520 * 1024;  // ESP32 has ~520KB SRAM
-    
-    Serial.printf("â•‘ Free Heap: %lu bytes\n", free_heap);
-    Serial.printf("â•‘ Min Free Heap: %lu bytes\n", min_free_heap);
-    Serial.printf("â•‘ Total Heap: %lu bytes\n", total_heap);
-    Serial.printf("â•‘ Heap Usage: %.1f%%\n", (float)(total_heap - free_heap) / total_heap * 100);
-    
-    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+void LogService::logToSerial(const char *data, uint16_t length) {
+    Serial.write((const uint8_t*)data, length);
 }
 
-void LogService::printUptime() {
-    uint32_t ms = millis();
-    uint32_t seconds = ms / 1000;
-    uint32_t minutes = seconds / 60;
-    uint32_t hours = minutes / 60;
-    uint32_t days = hours / 24;
-    
-    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
-    Serial.println("â•‘  SYSTEM UPTIME                    â•‘");
-    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
-    
-    Serial.printf("â•‘ %lu days, %02lu:%02lu:%02lu\n",
-        days,
-        hours % 24,
-        minutes % 60,
-        seconds % 60);
-    
-    Serial.printf("â•‘ Total ms: %lu\n", ms);
-    
-    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+void LogService::logToFile(const char *data, uint16_t length) {
+    if (!file_logging_enabled) return;
+
+    // Keep one previous file
+    if (file_size > 0 && file_size + length > LOG_FILE_MAX_BYTES) {
+        char rotated[STORAGE_PATH_MAX];
+        snprintf(rotated, sizeof(rotated), "%s.1", LOG_FILE_PATH);
+        if (StorageService::fileExists(rotated)) {
+            StorageService::deleteFile(rotated);
+        }
+        StorageService::renameFile(LOG_FILE_PATH, rotated);
+        file_size = 0;
+    }
+
+    // One open per batch, without appendFile()'s per-call serial note
+    StorageHandle handle = StorageService::openStream(LOG_FILE_PATH, STORAGE_MODE_APPEND);
+    int32_t written = -1;
+    if (handle != STORAGE_NO_HANDLE) {
+        written = StorageService::write(handle, (const uint8_t*)data, length);
+        StorageService::closeStream(handle);
+    }
+
+    if (written != (int32_t)length) {
+        file_logging_enabled = false;
+        Serial.printf("[LOG] Cannot write %s, file logging disabled\n", LOG_FILE_PATH);
+        return;
+    }
+    file_size += length;
+    stats.file_bytes += length;
+}
+
+void LogService::enableFileLogging(bool enable) {
+    file_logging_enabled = enable;
+    if (enable) {
+        Serial.printf("[LOG] File logging enabled: %s\n", LOG_FILE_PATH);
+    } else {
+        Serial.println("[LOG] File logging disabled");
+    }
 }
 
-// Helper macro implementations (if not using macros)
-void LogService::assert_fail(const char *condition, const char *file, uint32_t line) {
-    logError("ASSERT", "Assertion failed: %s at %s:%lu", condition, file, line);
+bool LogService::isFileLoggingEnabled() {
+    return file_logging_enabled;
 }
 
-void LogService::panic(const char *message) {
-    logError("PANIC", "System panic: %s", message);
-    Serial.println("\n!!! SYSTEM PANIC !!!");
-    Serial.println("Rebooting in 5 seconds...");
-    delay(5000);
-    ESP.restart();
+bool LogService::clearLogFile() {
+    file_size = 0;
+    if (!StorageService::fileExists(LOG_FILE_PATH)) {
+        return true;
+    }
+    return StorageService::deleteFile(LOG_FILE_PATH);
+}
+
+uint32_t LogService::getLogFileSize() {
+    return file_size;
+}
+
+const char* LogService::levelToString(LogLevel level) {
+    return (level <= LOG_CRITICAL) ? LOG_LEVEL_NAMES[level] : "?";
+}
+
+void LogService::printDebugInfo() {
+    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
+    Serial.println("â•‘  LOG SERVICE DEBUG INFO          â•‘");
+    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
+    Serial.printf("â•‘ Current Level: %s, file logging: %s (%lu bytes)\n",
+        levelToString(getLogLevel()), file_logging_enabled ? "ENABLED" : "DISABLED",
+        (unsigned long)file_size);
+    Serial.printf("â•‘ Queued: %lu / %u records, %u tags\n",
+        (unsigned long)ring.size(), LOG_RING_SIZE, tag_count);
+    Serial.printf("â•‘ Written: %lu records in %lu batches, %lu file bytes\n",
+        (unsigned long)stats.records, (unsigned long)stats.batches, (unsigned long)stats.file_bytes);
+    Serial.printf("â•‘ Dropped: %lu, truncated: %lu\n",
+        (unsigned long)ring.getDropped(), (unsigned long)stats.truncated);
+    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
 }
@@ -2,11 +2,29 @@
 #define IONOS_LOG_SERVICE_H
 
 #include <stdint.h>
+#include <stdarg.h>
 #include <Arduino.h>
+#include "../config/system_config.h"
+#include "../core/events.h"
+#include "../core/mpsc_ring.h"
 
 // ============================================================================
 // ionOS v1.0 - LOG SERVICE
-// System logging to serial and optional SD card
+// System logging to serial and an optional log file (internal flash)
+//
+// Logging never formats or writes on the caller's thread. A call captures a
+// compact binary record (timestamp, level, tag id, format pointer and the
+// raw arguments, %s text copied in) and pushes it into a lock-free ring;
+// a service-runner task formats queued records every LOG_FLUSH_INTERVAL_MS
+// and writes them to serial and LOG_FILE_PATH in batches. A call costs a
+// few microseconds at any level instead of a blocking UART write. Only
+// LogService calls are deferred: the kernel, drivers and services still
+// print their diagnostics with Serial directly. When the ring is full the
+// record is dropped and counted.
+//
+// Before init() (and after shutdown()) calls are written out synchronously.
+// The format string is kept by pointer: pass a string literal (or other
+// string that lives forever). Not for use from ISRs.
 // ============================================================================
 
 enum LogLevel {
@@ -17,29 +35,50 @@ enum LogLevel {
     LOG_CRITICAL = 4    // Critical failures
 };
 
+// Tag ids name the subsystem a record came from
+typedef uint8_t LogTag;
+static const LogTag LOG_TAG_SYSTEM = 0;
+
+struct LogStats {
+    uint32_t records;           // Records written out
+    uint32_t dropped;           // Records lost to a full ring
+    uint32_t truncated;         // Records whose arguments did not fit
+    uint32_t batches;           // Flush task runs that wrote something
+    uint32_t file_bytes;        // Bytes appended to the log file
+};
+
 class LogService {
 public:
-    // Initialize logging
-    static bool init(LogLevel level = LOG_INFO);
-    static void shutdown();
+    // Initialize logging (after Kernel::init() and StorageService::init())
+    static bool init(LogLevel level = (LogLevel)LOG_LEVEL);
+    static void shutdown();     // Writes out what is queued
 
     // Set log level
     static void setLogLevel(LogLevel level);
     static LogLevel getLogLevel();
 
+    // Tags (register at init; returns LOG_TAG_SYSTEM when the table is full)
+    static LogTag registerTag(const char *name);
+
     // Logging functions (use printf-style formatting)
-    static void debug(const char *format, ...);
-    static void info(const char *format, ...);
-    static void warn(const char *format, ...);
-    static void error(const char *format, ...);
-    static void critical(const char *format, ...);
+    static void debug(const char *format, ...) __attribute__((format(printf, 1, 2)));
+    static void info(const char *format, ...) __attribute__((format(printf, 1, 2)));
+    static void warn(const char *format, ...) __attribute__((format(printf, 1, 2)));
+    static void error(const char *format, ...) __attribute__((format(printf, 1, 2)));
+    static void critical(const char *format, ...) __attribute__((format(printf, 1, 2)));
 
     // Core logging function
-    static void log(LogLevel level, const char *format, ...);
+    static void log(LogLevel level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+    static void logTagged(LogLevel level, LogTag tag, const char *format, ...) __attribute__((format(printf, 3, 4)));
+    static void vlog(LogLevel level, LogTag tag, const char *format, va_list args);
 
-    // Direct logging (raw)
+    // Direct logging (raw; the text is copied, up to LOG_ARG_BYTES - 1 chars)
     static void logRaw(const char *message);
 
+    // Write out everything queued now (before sleep or a reset); false if
+    // the flush task is already doing it
+    static bool flush();
+
     // File logging control
     static void enableFileLogging(bool enable);
     static bool isFileLoggingEnabled();
@@ -50,16 +89,47 @@ public:
     // Get log file size
     static uint32_t getLogFileSize();
 
+    // Debug
+    static const LogStats& getStats() { return stats; }
+    static void printDebugInfo();
+
 private:
-    static LogLevel current_level;
+    // One queued log call. Arguments are stored back to back in the order
+    // the format consumes them, each at its promoted C type.
+    struct LogRecord {
+        uint32_t timestamp_ms;
+        const char *format;     // nullptr: args holds raw text
+        uint8_t level;
+        LogTag tag;
+        uint8_t arg_bytes;
+        uint8_t truncated;      // Arguments past arg_bytes were dropped
+        uint8_t args[LOG_ARG_BYTES];
+    };
+    static_assert(sizeof(void*) != 4 || sizeof(LogRecord) == 12 + LOG_ARG_BYTES,
+                  "LogRecord header changed: update the LOG_RING_SIZE note in system_config.h");
+
+    static bool initialized;
+    static int8_t task_id;
+    static volatile uint8_t current_level;
     static bool file_logging_enabled;
-    static const char *LOG_FILE;
-    static const uint32_t MAX_LOG_FILE_SIZE;
+    static uint32_t file_size;
+    static const char *tag_names[LOG_MAX_TAGS];
+    static uint8_t tag_count;
+    static LogStats stats;
+    static MpscRing<LogRecord, LOG_RING_SIZE> ring;
+    static std::atomic<bool> draining;     // flush() and the task share one consumer
+
+    static void flushTask();
+    static void onPowerEvent(const Event &event);
 
     // Internal helpers
     static const char* levelToString(LogLevel level);
-    static void logToSerial(const char *message);
-    static void logToFile(const char *message);
+    static void push(LogRecord &record);
+    static uint8_t captureArgs(const char *format, va_list args, uint8_t *out, bool &truncated);
+    static uint16_t formatRecord(const LogRecord &record, char *out, uint16_t capacity);
+    static uint32_t drain();       // Records written
+    static void logToSerial(const char *data, uint16_t length);
+    static void logToFile(const char *data, uint16_t length);
 };
 
 // Convenience macros for logging
@@ -1,5 +1,8 @@
 #include "network_service.h"
 #include <Arduino.h>
+#include <string.h>
+#include "../core/kernel.h"
+#include "../core/event_payload.h"
 
 // ============================================================================
 // ionOS v1.0 - NETWORK SERVICE IMPLEMENTATION
@@ -11,6 +14,9 @@ WiFiState NetworkService::current_state = WIFI_DISCONNECTED;
 bool NetworkService::init() {
     Serial.println("[NETWORK] Network service initialized");
     current_state = WIFI_DISCONNECTED;
+
+    // Status polling (and later transfers) stay off the render core
+    Kernel::registerTask("network", update, NETWORK_UPDATE_INTERVAL_MS * 1000UL, false, RUNNER_STREAM);
     return true;
 }
 
@@ -93,6 +99,32 @@ bool NetworkService::httpPost(const char *url, const char *data, char *response,
     return true;
 }
 
+bool NetworkService::postHttpGet(const char *url) {
+    // Response body goes straight into a pool block, no copy or malloc
+    EventPayload *payload = EventPayloads::alloc();
+    if (payload == nullptr) {
+        Serial.println("[NETWORK] No payload block for response");
+        return false;
+    }
+
+    char *body = (char*)payload->data;
+    if (!httpGet(url, body, EVENT_PAYLOAD_SIZE)) {
+        EventPayloads::release(payload);
+        return false;
+    }
+    payload->length = strlen(body) + 1;
+
+    Event event = {
+        .type = EVENT_NETWORK_RESPONSE,
+        .priority = PRIORITY_NORMAL,
+        .timestamp = millis(),
+        .data1 = 0,
+        .data2 = 0,
+        .data3 = payload
+    };
+    return Kernel::postEvent(event);
+}
+
 void NetworkService::update() {
     // Periodic WiFi status check
     // TODO: Monitor WiFi connection status
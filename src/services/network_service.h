@@ -35,6 +35,7 @@ public:
     // HTTP operations
     static bool httpGet(const char *url, char *response, uint32_t max_len);
     static bool httpPost(const char *url, const char *data, char *response, uint32_t max_len);
+    static bool postHttpGet(const char *url);  // Response arrives as EVENT_NETWORK_RESPONSE
 
     // Update handler
     static void update();
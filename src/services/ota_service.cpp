@@ -1,5 +1,7 @@
 #include "ota_service.h"
 #include <Arduino.h>
+#include <Update.h>
+#include "storage_service.h"
 
 // ============================================================================
 // ionOS v1.0 - OTA SERVICE IMPLEMENTATION
@@ -10,6 +12,9 @@ OTAState OTAService::current_state = OTA_IDLE;
 uint8_t OTAService::download_progress = 0;
 char OTAService::error_message[64] = {0};
 
+// Firmware images are far larger than RAM: they go to flash a chunk at a time
+static uint8_t flash_chunk[OTA_FLASH_CHUNK];
+
 bool OTAService::init() {
     current_state = OTA_IDLE;
     download_progress = 0;
@@ -85,15 +90,44 @@ bool OTAService::verifySignature(const char *filepath) {
 }
 
 bool OTAService::flashFirmware(const char *filepath) {
-    // TODO: Use ESP.updateFromFS() or similar to flash firmware
     Serial.printf("[OTA] Flashing firmware from: %s\n", filepath);
     current_state = OTA_FLASHING;
-    
-    // Simulate flashing progress
-    for (uint8_t i = 0; i <= 100; i += 10) {
-        download_progress = i;
-        Serial.printf("[OTA] Flash progress: %d%%\n", i);
-        delay(500);
+    download_progress = 0;
+
+    FileReader reader;
+    if (!reader.open(filepath, flash_chunk, sizeof(flash_chunk)) || reader.size() == 0) {
+        current_state = OTA_ERROR;
+        snprintf(error_message, sizeof(error_message), "Cannot read %s", filepath);
+        Serial.printf("[OTA] %s\n", error_message);
+        return false;
+    }
+
+    if (!Update.begin(reader.size())) {
+        current_state = OTA_ERROR;
+        snprintf(error_message, sizeof(error_message), "Update begin failed: %s", Update.errorString());
+        Serial.printf("[OTA] %s\n", error_message);
+        return false;
+    }
+
+    uint8_t last_reported = 0;
+    while (reader.next()) {
+        if (Update.write(flash_chunk, reader.length()) != reader.length()) {
+            break;
+        }
+
+        download_progress = (uint8_t)((uint64_t)(reader.offset() + reader.length()) * 100 / reader.size());
+        if (download_progress >= last_reported + 10) {
+            last_reported = download_progress;
+            Serial.printf("[OTA] Flash progress: %d%%\n", download_progress);
+        }
+    }
+
+    if (reader.hasError() || !Update.end()) {
+        Update.abort();
+        current_state = OTA_ERROR;
+        snprintf(error_message, sizeof(error_message), "Flash failed: %s", Update.errorString());
+        Serial.printf("[OTA] %s\n", error_message);
+        return false;
     }
     
     current_state = OTA_COMPLETE;
@@ -0,0 +1,518 @@
+#include "settings_store.h"
+#include "storage_service.h"
+#include "../core/kernel.h"
+#include <string.h>
+
+#ifdef IONOS_NATIVE
+#include <pthread.h>
+#else
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+// ============================================================================
+// ionOS v1.0 - SETTINGS STORE IMPLEMENTATION
+// Record log format (little endian):
+//   [0] magic  [1] flags  [2] key length  [3] value length
+//   [4..7] CRC-32 of the header bytes 0..3, key and value
+//   key (no terminator), value
+// ============================================================================
+
+static const uint8_t RECORD_MAGIC = 0xA7;
+static const uint8_t RECORD_REMOVED = 0x01;         // Tombstone
+static const uint8_t RECORD_HEADER = 8;
+static const uint16_t RECORD_MAX = RECORD_HEADER + SETTINGS_KEY_MAX - 1 + SETTINGS_VALUE_MAX;
+static const uint8_t NO_ENTRY = 0xFF;
+
+bool SettingsStore::initialized = false;
+int8_t SettingsStore::task_id = -1;
+SettingsStore::Entry SettingsStore::entries[SETTINGS_MAX_KEYS];
+uint8_t SettingsStore::entry_count = 0;
+uint8_t SettingsStore::index[SETTINGS_INDEX_SLOTS];
+uint32_t SettingsStore::log_size = 0;
+uint32_t SettingsStore::first_change_ms = 0;
+bool SettingsStore::pending = false;
+std::atomic<bool> SettingsStore::writing(false);
+SettingsStats SettingsStore::stats = { 0, 0, 0, 0, 0 };
+
+// Entry table lock: set()/get() on the app side, commits on the service
+// runner. Never held across storage I/O.
+#ifdef IONOS_NATIVE
+static pthread_mutex_t settings_mutex = PTHREAD_MUTEX_INITIALIZER;
+#else
+static StaticSemaphore_t settings_mutex_buffer;
+static SemaphoreHandle_t settings_mutex = nullptr;
+#endif
+
+class SettingsLock {
+public:
+    SettingsLock() {
+#ifdef IONOS_NATIVE
+        pthread_mutex_lock(&settings_mutex);
+#else
+        if (settings_mutex != nullptr) xSemaphoreTake(settings_mutex, portMAX_DELAY);
+#endif
+    }
+    ~SettingsLock() {
+#ifdef IONOS_NATIVE
+        pthread_mutex_unlock(&settings_mutex);
+#else
+        if (settings_mutex != nullptr) xSemaphoreGive(settings_mutex);
+#endif
+    }
+};
+
+// Nibble-table CRC-32 (IEEE 802.3, reflected)
+static uint32_t crc32(uint32_t crc, const uint8_t *data, uint32_t length) {
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    crc = ~crc;
+    for (uint32_t i = 0; i < length; i++) {
+        crc = table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+        crc = table[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+// FNV-1a
+static uint32_t hashKey(const char *key) {
+    uint32_t hash = 2166136261UL;
+    while (*key) {
+        hash = (hash ^ (uint8_t)*key++) * 16777619UL;
+    }
+    return hash;
+}
+
+bool SettingsStore::init() {
+#ifndef IONOS_NATIVE
+    if (settings_mutex == nullptr) {
+        settings_mutex = xSemaphoreCreateMutexStatic(&settings_mutex_buffer);
+    }
+#endif
+
+    entry_count = 0;
+    memset(index, NO_ENTRY, sizeof(index));
+    pending = false;
+
+    // The index is usable from here on; replaying the log fills it
+    initialized = true;
+    if (!load()) {
+        initialized = false;
+        Serial.println("[SETTINGS] Settings log unavailable; using defaults");
+        return false;
+    }
+
+    // Commits run on the service runner once changes go quiet
+    if (task_id < 0) {
+        task_id = Kernel::registerTask("settings", commitTask, SETTINGS_COMMIT_DELAY_MS * 1000UL, true);
+        Kernel::subscribe(EVENT_POWER_SLEEP, onPowerEvent);
+        Kernel::subscribe(EVENT_POWER_LOW_BATTERY, onPowerEvent);
+    }
+
+    Serial.printf("[SETTINGS] %u settings loaded (%lu byte log)\n", entry_count, (unsigned long)log_size);
+    return true;
+}
+
+void SettingsStore::shutdown() {
+    commit();
+    initialized = false;
+}
+
+// Lookups
+bool SettingsStore::set(const char *key, const void *value, uint8_t length) {
+    if (value == nullptr && length > 0) return false;
+    return store(key, value, length, true);
+}
+
+int16_t SettingsStore::get(const char *key, void *value, uint8_t capacity) {
+    SettingsLock guard;
+    Entry *entry = find(key);
+    if (entry == nullptr || !entry->present) return -1;
+
+    uint8_t length = entry->length < capacity ? entry->length : capacity;
+    if (value != nullptr) memcpy(value, entry->value, length);
+    return entry->length;
+}
+
+bool SettingsStore::remove(const char *key) {
+    return store(key, nullptr, 0, false);
+}
+
+bool SettingsStore::contains(const char *key) {
+    SettingsLock guard;
+    Entry *entry = find(key);
+    return entry != nullptr && entry->present;
+}
+
+bool SettingsStore::setU32(const char *key, uint32_t value) {
+    uint8_t bytes[4] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) };
+    return set(key, bytes, sizeof(bytes));
+}
+
+uint32_t SettingsStore::getU32(const char *key, uint32_t fallback) {
+    uint8_t bytes[4];
+    if (get(key, bytes, sizeof(bytes)) != sizeof(bytes)) return fallback;
+    return bytes[0] | (bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+bool SettingsStore::setString(const char *key, const char *value) {
+    if (value == nullptr) return false;
+    size_t length = strlen(value);
+    if (length > SETTINGS_VALUE_MAX) return false;
+    return set(key, value, (uint8_t)length);
+}
+
+bool SettingsStore::getString(const char *key, char *value, uint32_t max_len) {
+    if (value == nullptr || max_len == 0) return false;
+    uint8_t capacity = max_len - 1 < SETTINGS_VALUE_MAX ? (uint8_t)(max_len - 1) : SETTINGS_VALUE_MAX;
+    int16_t length = get(key, value, capacity);
+    if (length < 0) {
+        value[0] = '\0';
+        return false;
+    }
+    value[length < capacity ? length : capacity] = '\0';
+    return true;
+}
+
+bool SettingsStore::hasPendingChanges() {
+    SettingsLock guard;
+    return pending;
+}
+
+// Hash index (entries are never freed: a removed key keeps its slot)
+SettingsStore::Entry* SettingsStore::find(const char *key) {
+    if (!initialized) return nullptr;
+
+    uint32_t slot = hashKey(key) & (SETTINGS_INDEX_SLOTS - 1);
+    for (uint8_t probe = 0; probe < SETTINGS_INDEX_SLOTS; probe++) {
+        uint8_t i = index[slot];
+        if (i == NO_ENTRY) return nullptr;
+        if (strcmp(entries[i].key, key) == 0) return &entries[i];
+        slot = (slot + 1) & (SETTINGS_INDEX_SLOTS - 1);
+    }
+    return nullptr;
+}
+
+SettingsStore::Entry* SettingsStore::insert(const char *key) {
+    // Before init() the index is not set up (all zeros, no free slot)
+    if (!initialized) return nullptr;
+    if (entry_count >= SETTINGS_MAX_KEYS) {
+        Serial.printf("[SETTINGS] No room for key: %s\n", key);
+        return nullptr;
+    }
+
+    uint32_t slot = hashKey(key) & (SETTINGS_INDEX_SLOTS - 1);
+    uint8_t probe = 0;
+    while (index[slot] != NO_ENTRY) {
+        if (++probe >= SETTINGS_INDEX_SLOTS) return nullptr;
+        slot = (slot + 1) & (SETTINGS_INDEX_SLOTS - 1);
+    }
+
+    Entry &entry = entries[entry_count];
+    strcpy(entry.key, key);
+    entry.length = 0;
+    entry.present = false;
+    entry.dirty = false;
+    index[slot] = entry_count++;
+    return &entry;
+}
+
+bool SettingsStore::store(const char *key, const void *value, uint8_t length, bool present) {
+    if (!initialized) {
+        Serial.println("[SETTINGS] Not initialized");
+        return false;
+    }
+    if (key == nullptr || key[0] == '\0' || strlen(key) >= SETTINGS_KEY_MAX || length > SETTINGS_VALUE_MAX) {
+        Serial.println("[SETTINGS] Invalid key or value size");
+        return false;
+    }
+
+    {
+        SettingsLock guard;
+        Entry *entry = find(key);
+        if (entry == nullptr) {
+            if (!present) return true;
+            entry = insert(key);
+            if (entry == nullptr) return false;
+        }
+
+        // Unchanged values cost nothing
+        if (entry->present == present && entry->length == length &&
+            (length == 0 || memcmp(entry->value, value, length) == 0)) {
+            return true;
+        }
+
+        if (length > 0) memcpy(entry->value, value, length);
+        entry->length = length;
+        entry->present = present;
+        entry->dirty = true;
+        if (!pending) {
+            pending = true;
+            first_change_ms = millis();
+        }
+        stats.sets++;
+    }
+
+    scheduleCommit();
+    return true;
+}
+
+void SettingsStore::scheduleCommit() {
+    if (task_id < 0) return;
+
+    // Each change pushes the commit back, up to SETTINGS_COMMIT_MAX_MS
+    if (millis() - first_change_ms < SETTINGS_COMMIT_MAX_MS) {
+        Kernel::setTaskPeriod(task_id, SETTINGS_COMMIT_DELAY_MS * 1000UL);
+    }
+    Kernel::signalTask(task_id);
+}
+
+// Record log
+uint16_t SettingsStore::encode(const Entry &entry, uint8_t *record) {
+    uint8_t key_length = (uint8_t)strlen(entry.key);
+    record[0] = RECORD_MAGIC;
+    record[1] = entry.present ? 0 : RECORD_REMOVED;
+    record[2] = key_length;
+    record[3] = entry.present ? entry.length : 0;
+    memcpy(record + RECORD_HEADER, entry.key, key_length);
+    memcpy(record + RECORD_HEADER + key_length, entry.value, record[3]);
+
+    uint16_t length = RECORD_HEADER + key_length + record[3];
+    uint32_t crc = crc32(0, record, 4);
+    crc = crc32(crc, record + RECORD_HEADER, length - RECORD_HEADER);
+    record[4] = (uint8_t)crc;
+    record[5] = (uint8_t)(crc >> 8);
+    record[6] = (uint8_t)(crc >> 16);
+    record[7] = (uint8_t)(crc >> 24);
+    return length;
+}
+
+// Validate the record at the start of data and load it; its length, or 0
+uint16_t SettingsStore::apply(const uint8_t *record, uint32_t available) {
+    if (available < RECORD_HEADER || record[0] != RECORD_MAGIC || (record[1] & ~RECORD_REMOVED) != 0) return 0;
+
+    uint8_t key_length = record[2];
+    uint8_t value_length = record[3];
+    uint16_t length = RECORD_HEADER + key_length + value_length;
+    if (key_length == 0 || key_length >= SETTINGS_KEY_MAX || value_length > SETTINGS_VALUE_MAX ||
+        length > available) {
+        return 0;
+    }
+
+    uint32_t crc = crc32(0, record, 4);
+    crc = crc32(crc, record + RECORD_HEADER, length - RECORD_HEADER);
+    uint32_t stored = record[4] | (record[5] << 8) | ((uint32_t)record[6] << 16) | ((uint32_t)record[7] << 24);
+    if (crc != stored) return 0;
+
+    char key[SETTINGS_KEY_MAX];
+    memcpy(key, record + RECORD_HEADER, key_length);
+    key[key_length] = '\0';
+    if (strlen(key) != key_length) return 0;
+
+    // Later records win
+    Entry *entry = find(key);
+    if (entry == nullptr) entry = insert(key);
+    if (entry != nullptr) {
+        entry->present = (record[1] & RECORD_REMOVED) == 0;
+        entry->length = value_length;
+        memcpy(entry->value, record + RECORD_HEADER + key_length, value_length);
+        entry->dirty = false;
+    }
+    return length;
+}
+
+bool SettingsStore::load() {
+    if (!StorageService::isMounted(FLASH_MOUNT_POINT)) return false;
+
+    // A compaction cut short: the new log is complete only once the old one is gone
+    char new_path[STORAGE_PATH_MAX];
+    snprintf(new_path, sizeof(new_path), "%s.new", SETTINGS_LOG_PATH);
+    if (StorageService::fileExists(new_path)) {
+        if (StorageService::fileExists(SETTINGS_LOG_PATH)) {
+            StorageService::deleteFile(new_path);
+        } else {
+            StorageService::renameFile(new_path, SETTINGS_LOG_PATH);
+        }
+    }
+
+    uint32_t size = StorageService::fileExists(SETTINGS_LOG_PATH) ? StorageService::getFileSize(SETTINGS_LOG_PATH) : 0;
+    uint32_t offset = 0;
+    uint32_t bad_records = 0;
+    bool in_gap = false;
+    uint8_t record[RECORD_MAX];
+
+    // Replay; after a torn or corrupt record, resync on the next valid one
+    while (offset < size) {
+        int32_t got = StorageService::readAt(SETTINGS_LOG_PATH, offset, record, sizeof(record));
+        if (got <= 0) break;
+
+        uint16_t length = apply(record, (uint32_t)got);
+        if (length > 0) {
+            offset += length;
+            in_gap = false;
+        } else {
+            if (!in_gap) bad_records++;
+            in_gap = true;
+            offset++;
+        }
+    }
+    StorageService::closeFile(SETTINGS_LOG_PATH);
+
+    log_size = size;
+    stats.bad_records += bad_records;
+    if (bad_records > 0) {
+        Serial.printf("[SETTINGS] Dropped %lu damaged records\n", (unsigned long)bad_records);
+        compact();
+    }
+    return true;
+}
+
+uint32_t SettingsStore::liveBytes() {
+    SettingsLock guard;
+    uint32_t bytes = 0;
+    for (uint8_t i = 0; i < entry_count; i++) {
+        if (entries[i].present) bytes += RECORD_HEADER + strlen(entries[i].key) + entries[i].length;
+    }
+    return bytes;
+}
+
+void SettingsStore::commitTask() {
+    commit();
+}
+
+bool SettingsStore::commit() {
+    if (!initialized || writing.exchange(true)) return false;
+
+    {
+        SettingsLock guard;
+        if (!pending) {
+            writing = false;
+            return true;
+        }
+        pending = false;
+    }
+
+    // One append for the whole batch; a key changed meanwhile is dirty again
+    StorageHandle handle = STORAGE_NO_HANDLE;
+    bool ok = true;
+    uint32_t written = 0;
+    uint32_t records = 0;
+    uint8_t record[RECORD_MAX];
+
+    for (uint8_t i = 0; i < SETTINGS_MAX_KEYS; i++) {
+        uint16_t length = 0;
+        {
+            SettingsLock guard;
+            if (i >= entry_count) break;
+            if (!entries[i].dirty) continue;
+            length = encode(entries[i], record);
+            entries[i].dirty = false;
+        }
+
+        if (ok && handle == STORAGE_NO_HANDLE) {
+            handle = StorageService::openStream(SETTINGS_LOG_PATH, STORAGE_MODE_APPEND);
+            ok = handle != STORAGE_NO_HANDLE;
+        }
+        if (ok && StorageService::write(handle, record, length) == (int32_t)length) {
+            written += length;
+            records++;
+        } else {
+            ok = false;
+            SettingsLock guard;
+            entries[i].dirty = true;
+            pending = true;
+        }
+    }
+    if (handle != STORAGE_NO_HANDLE) StorageService::closeStream(handle);
+
+    log_size += written;
+    if (records > 0) {
+        stats.commits++;
+        stats.records_written += records;
+    }
+    writing = false;
+
+    if (!ok) {
+        Serial.println("[SETTINGS] Commit failed, will retry");
+        scheduleCommit();
+        return false;
+    }
+
+    if (log_size >= SETTINGS_COMPACT_BYTES && log_size > 2 * liveBytes()) {
+        compact();
+    }
+    return true;
+}
+
+bool SettingsStore::compact() {
+    if (!initialized || writing.exchange(true)) return false;
+
+    // Live records into a new log, which then replaces the old one
+    char new_path[STORAGE_PATH_MAX];
+    snprintf(new_path, sizeof(new_path), "%s.new", SETTINGS_LOG_PATH);
+    StorageHandle handle = StorageService::openStream(new_path, STORAGE_MODE_WRITE);
+    bool ok = handle != STORAGE_NO_HANDLE;
+    uint32_t written = 0;
+    uint8_t record[RECORD_MAX];
+
+    for (uint8_t i = 0; ok && i < SETTINGS_MAX_KEYS; i++) {
+        uint16_t length = 0;
+        {
+            SettingsLock guard;
+            if (i >= entry_count) break;
+            if (!entries[i].present) {
+                entries[i].dirty = false;
+                continue;
+            }
+            length = encode(entries[i], record);
+            entries[i].dirty = false;
+        }
+        ok = StorageService::write(handle, record, length) == (int32_t)length;
+        written += length;
+    }
+    if (handle != STORAGE_NO_HANDLE) StorageService::closeStream(handle);
+
+    if (ok) {
+        StorageService::deleteFile(SETTINGS_LOG_PATH);
+        ok = StorageService::renameFile(new_path, SETTINGS_LOG_PATH);
+    }
+
+    if (ok) {
+        log_size = written;
+        stats.compactions++;
+    } else {
+        // Everything goes out again with the next commit
+        Serial.println("[SETTINGS] Compaction failed");
+        SettingsLock guard;
+        for (uint8_t i = 0; i < entry_count; i++) entries[i].dirty = true;
+        pending = true;
+    }
+    writing = false;
+    return ok;
+}
+
+// Deep sleep loses RAM: write what is pending first. This runs on the
+// kernel loop, so the flash write is handed to the service runner now
+// instead of after the batching delay.
+void SettingsStore::onPowerEvent(const Event &event) {
+    (void)event;
+    if (task_id < 0 || !hasPendingChanges()) return;
+    Kernel::setTaskPeriod(task_id, 0);
+    Kernel::signalTask(task_id);
+}
+
+void SettingsStore::printDebugInfo() {
+    Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
+    Serial.println("â•‘  SETTINGS STORE DEBUG INFO       â•‘");
+    Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
+    Serial.printf("â•‘ Keys: %u / %u, log %lu bytes (%lu live)\n", entry_count, SETTINGS_MAX_KEYS,
+        (unsigned long)log_size, (unsigned long)liveBytes());
+    Serial.printf("â•‘ Changes: %lu, commits: %lu (%lu records), compactions: %lu\n",
+        (unsigned long)stats.sets, (unsigned long)stats.commits,
+        (unsigned long)stats.records_written, (unsigned long)stats.compactions);
+    Serial.printf("â•‘ Pending: %s, damaged records dropped: %lu\n",
+        hasPendingChanges() ? "YES" : "NO", (unsigned long)stats.bad_records);
+    Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
+}
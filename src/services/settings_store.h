@@ -0,0 +1,92 @@
+#ifndef IONOS_SETTINGS_STORE_H
+#define IONOS_SETTINGS_STORE_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <atomic>
+#include "../config/system_config.h"
+#include "../core/events.h"
+
+// ============================================================================
+// ionOS v1.0 - SETTINGS STORE
+// Persistent key-value settings (brightness, volume, timeouts, ...)
+//
+// Every value lives in RAM behind a hash index, so get() never touches
+// storage. On flash the store is an append-only log of CRC-checked records
+// (SETTINGS_LOG_PATH): init() replays it, last record per key wins. set()
+// only marks the key dirty; a service task appends all dirty keys in one
+// write once changes have been quiet for SETTINGS_COMMIT_DELAY_MS, so
+// scrolling a slider costs one flash write, not one per step. When the log
+// is mostly superseded records it is rewritten with just the live ones.
+//
+// Call init() after Kernel::init() and StorageService::init(); until then
+// set() fails and get() finds nothing.
+// ============================================================================
+
+struct SettingsStats {
+    uint32_t sets;              // set() calls that changed a value
+    uint32_t commits;           // Log appends (one per batch)
+    uint32_t records_written;   // Records appended
+    uint32_t compactions;
+    uint32_t bad_records;       // Torn or corrupt records dropped at init
+};
+
+class SettingsStore {
+public:
+    static bool init();
+    static void shutdown();     // Commits pending changes
+
+    // Values are up to SETTINGS_VALUE_MAX bytes; keys up to SETTINGS_KEY_MAX - 1 chars
+    static bool set(const char *key, const void *value, uint8_t length);
+    static int16_t get(const char *key, void *value, uint8_t capacity);    // Length, -1 if absent
+    static bool remove(const char *key);
+    static bool contains(const char *key);
+
+    static bool setU32(const char *key, uint32_t value);
+    static uint32_t getU32(const char *key, uint32_t fallback);
+    static bool setString(const char *key, const char *value);
+    static bool getString(const char *key, char *value, uint32_t max_len);
+
+    // Write pending changes now (before sleep or power off)
+    static bool commit();
+    static bool compact();
+    static bool hasPendingChanges();
+
+    // Debug
+    static const SettingsStats& getStats() { return stats; }
+    static void printDebugInfo();
+
+private:
+    struct Entry {
+        char key[SETTINGS_KEY_MAX];
+        uint8_t value[SETTINGS_VALUE_MAX];
+        uint8_t length;
+        bool present;           // false = removed (a tombstone is pending or logged)
+        bool dirty;             // Changed since the last commit
+    };
+
+    static bool initialized;
+    static int8_t task_id;
+    static Entry entries[SETTINGS_MAX_KEYS];
+    static uint8_t entry_count;
+    static uint8_t index[SETTINGS_INDEX_SLOTS];
+    static uint32_t log_size;           // Bytes in the log file
+    static uint32_t first_change_ms;    // Oldest uncommitted change
+    static bool pending;
+    static std::atomic<bool> writing;   // A commit or compaction owns the log
+    static SettingsStats stats;
+
+    static void commitTask();
+    static void onPowerEvent(const Event &event);
+
+    static Entry* find(const char *key);
+    static Entry* insert(const char *key);
+    static bool store(const char *key, const void *value, uint8_t length, bool present);
+    static void scheduleCommit();
+    static bool load();
+    static uint16_t apply(const uint8_t *record, uint32_t available);
+    static uint16_t encode(const Entry &entry, uint8_t *record);
+    static uint32_t liveBytes();
+};
+
+#endif // IONOS_SETTINGS_STORE_H
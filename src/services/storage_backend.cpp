@@ -0,0 +1,71 @@
+#include "storage_backend.h"
+#include "../config/pinmap.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <LittleFS.h>
+
+// ============================================================================
+// ionOS v1.0 - STORAGE BACKENDS IMPLEMENTATION
+// ============================================================================
+
+// SD card
+SdBackend::SdBackend() : StorageBackend(SD) {
+}
+
+bool SdBackend::begin() {
+    // MOSI: GPIO 23, MISO: GPIO 19, SCK: GPIO 18
+    return SD.begin(SD_CS_PIN);
+}
+
+void SdBackend::end() {
+    SD.end();
+}
+
+bool SdBackend::isPresent() {
+    return SD.cardType() != CARD_NONE;
+}
+
+bool SdBackend::getSpace(uint64_t &total_bytes, uint64_t &used_bytes) {
+    total_bytes = SD.totalBytes();
+    used_bytes = SD.usedBytes();
+    return total_bytes > 0;
+}
+
+// Internal flash
+FlashBackend::FlashBackend() : StorageBackend(LittleFS) {
+}
+
+bool FlashBackend::begin() {
+    // An unformatted partition (first boot) is formatted rather than failed
+    return LittleFS.begin(true);
+}
+
+void FlashBackend::end() {
+    LittleFS.end();
+}
+
+bool FlashBackend::getSpace(uint64_t &total_bytes, uint64_t &used_bytes) {
+    total_bytes = LittleFS.totalBytes();
+    used_bytes = LittleFS.usedBytes();
+    return total_bytes > 0;
+}
+
+#ifdef IONOS_NATIVE
+// Host directory
+HostBackend::HostBackend(const char *root) : StorageBackend(host), host(root) {
+}
+
+bool HostBackend::begin() {
+    return host.begin();
+}
+
+void HostBackend::end() {
+    host.end();
+}
+
+bool HostBackend::getSpace(uint64_t &total_bytes, uint64_t &used_bytes) {
+    total_bytes = host.totalBytes();
+    used_bytes = host.usedBytes();
+    return total_bytes > 0;
+}
+#endif
@@ -0,0 +1,72 @@
+#ifndef IONOS_STORAGE_BACKEND_H
+#define IONOS_STORAGE_BACKEND_H
+
+#include <stdint.h>
+#include <FS.h>
+
+// ============================================================================
+// ionOS v1.0 - STORAGE BACKENDS
+// Volumes StorageService can mount. A backend brings its filesystem up and
+// down and reports its space; files are opened through its fs::FS, which
+// every Arduino-ESP32 filesystem (SD, LittleFS) implements, so the handle
+// table and read-ahead work the same on all of them.
+// ============================================================================
+
+class StorageBackend {
+public:
+    explicit StorageBackend(fs::FS &filesystem) : filesystem(filesystem) {}
+    virtual ~StorageBackend() = default;
+
+    virtual const char* getName() const = 0;
+    virtual bool begin() = 0;
+    virtual void end() = 0;
+    virtual bool isPresent() { return true; }      // Media still there
+    virtual bool getSpace(uint64_t &total_bytes, uint64_t &used_bytes) = 0;
+
+    fs::FS& getFS() { return filesystem; }
+
+protected:
+    fs::FS &filesystem;
+};
+
+// MicroSD card on the SPI bus (pinmap.h)
+class SdBackend : public StorageBackend {
+public:
+    SdBackend();
+
+    const char* getName() const override { return "SD"; }
+    bool begin() override;
+    void end() override;
+    bool isPresent() override;
+    bool getSpace(uint64_t &total_bytes, uint64_t &used_bytes) override;
+};
+
+// LittleFS on the internal flash data partition (formatted on first mount)
+class FlashBackend : public StorageBackend {
+public:
+    FlashBackend();
+
+    const char* getName() const override { return "Flash"; }
+    bool begin() override;
+    void end() override;
+    bool getSpace(uint64_t &total_bytes, uint64_t &used_bytes) override;
+};
+
+#ifdef IONOS_NATIVE
+// A directory on the host, without simulated device cost (native builds
+// only): lets harnesses run the storage stack against plain files
+class HostBackend : public StorageBackend {
+public:
+    explicit HostBackend(const char *root);
+
+    const char* getName() const override { return "Host"; }
+    bool begin() override;
+    void end() override;
+    bool getSpace(uint64_t &total_bytes, uint64_t &used_bytes) override;
+
+private:
+    fs::HostFS host;
+};
+#endif
+
+#endif // IONOS_STORAGE_BACKEND_H
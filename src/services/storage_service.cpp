@@ -1,60 +1,213 @@
 #include "storage_service.h"
+#include "settings_store.h"
 #include <Arduino.h>
-#include <SD.h>
+#include "../core/kernel.h"
+#include "../core/event_payload.h"
+#include <string.h>
+
+#ifdef IONOS_NATIVE
+#include <pthread.h>
+#else
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
 
 // ============================================================================
 // ionOS v1.0 - STORAGE SERVICE IMPLEMENTATION
-// SD card file I/O operations
+// File I/O over the mount table
 // ============================================================================
 
-bool StorageService::is_initialized = false;
+bool StorageService::initialized = false;
+StorageService::Mount StorageService::mounts[STORAGE_MAX_MOUNTS];
+StorageService::FileHandle StorageService::handles[STORAGE_OPEN_FILES];
+uint32_t StorageService::handle_clock = 0;
+StorageStats StorageService::stats = { 0, 0, 0, 0, 0 };
+
+// Handle table lock (public calls only; helpers run under it). Held across
+// the card transfer, so a long bulk read delays other callers, not corrupts
+// their handles.
+#ifdef IONOS_NATIVE
+static pthread_mutex_t storage_mutex = PTHREAD_MUTEX_INITIALIZER;
+#else
+static StaticSemaphore_t storage_mutex_buffer;
+static SemaphoreHandle_t storage_mutex = nullptr;
+#endif
+
+class StorageLock {
+public:
+    StorageLock() {
+#ifdef IONOS_NATIVE
+        pthread_mutex_lock(&storage_mutex);
+#else
+        if (storage_mutex != nullptr) xSemaphoreTake(storage_mutex, portMAX_DELAY);
+#endif
+    }
+    ~StorageLock() {
+#ifdef IONOS_NATIVE
+        pthread_mutex_unlock(&storage_mutex);
+#else
+        if (storage_mutex != nullptr) xSemaphoreGive(storage_mutex);
+#endif
+    }
+};
+
+static SdBackend sd_backend;
+static FlashBackend flash_backend;
 
 bool StorageService::init() {
-    // Initialize SPI and SD card
-    // CS pin: GPIO 5
-    // MOSI: GPIO 23, MISO: GPIO 19, SCK: GPIO 18
-    
-    if (!SD.begin(5)) {
-        Serial.println("[STORAGE] SD card initialization failed!");
-        is_initialized = false;
+#ifndef IONOS_NATIVE
+    if (storage_mutex == nullptr) {
+        storage_mutex = xSemaphoreCreateMutexStatic(&storage_mutex_buffer);
+    }
+#endif
+
+    initialized = true;
+    closeAll();
+
+    // Either volume may be missing; the other still works without it
+    mount(SD_MOUNT_POINT, &sd_backend);
+    mount(FLASH_MOUNT_POINT, &flash_backend);
+    if (!isMounted(SD_MOUNT_POINT) && !isMounted(FLASH_MOUNT_POINT)) {
+        Serial.println("[STORAGE] No storage volume available!");
+        initialized = false;
         return false;
     }
-    
-    is_initialized = true;
-    Serial.println("[STORAGE] SD card initialized successfully");
+
+    // Suspended apps can now be trimmed to a snapshot under memory pressure
+    Kernel::setSnapshotStore(writeAppSnapshot, readAppSnapshot);
     return true;
 }
 
 void StorageService::shutdown() {
-    // SD.end() not available in Arduino SD library
-    is_initialized = false;
-    Serial.println("[STORAGE] SD card disabled");
+    Kernel::setSnapshotStore(nullptr, nullptr);
+    closeAll();
+    for (uint8_t i = 0; i < STORAGE_MAX_MOUNTS; i++) {
+        if (mounts[i].backend != nullptr) unmount(mounts[i].point);
+    }
+    initialized = false;
+    Serial.println("[STORAGE] Storage disabled");
 }
 
-bool StorageService::fileExists(const char *filepath) {
-    if (!is_initialized) return false;
-    
-    return SD.exists(filepath);
-}
+// Mount table
+bool StorageService::mount(const char *mount_point, StorageBackend *backend) {
+    StorageLock guard;
+    if (!initialized || mount_point == nullptr || backend == nullptr) return false;
 
-bool StorageService::createFile(const char *filepath) {
-    if (!is_initialized) return false;
-    
-    File file = SD.open(filepath, FILE_WRITE);
-    if (!file) {
-        Serial.printf("[STORAGE] Failed to create file: %s\n", filepath);
+    size_t length = strlen(mount_point);
+    if (mount_point[0] != '/' || length >= sizeof(mounts[0].point) ||
+        (length > 1 && mount_point[length - 1] == '/')) {
+        Serial.printf("[STORAGE] Invalid mount point: %s\n", mount_point);
         return false;
     }
-    
-    file.close();
-    Serial.printf("[STORAGE] File created: %s\n", filepath);
+
+    Mount *existing = findMount(mount_point);
+    if (existing != nullptr) return existing->backend == backend;
+
+    Mount *slot = nullptr;
+    for (uint8_t i = 0; i < STORAGE_MAX_MOUNTS && slot == nullptr; i++) {
+        if (mounts[i].backend == nullptr) slot = &mounts[i];
+    }
+    if (slot == nullptr) {
+        Serial.println("[STORAGE] Mount table full");
+        return false;
+    }
+
+    if (!backend->begin()) {
+        Serial.printf("[STORAGE] %s volume failed to mount at %s\n", backend->getName(), mount_point);
+        return false;
+    }
+
+    strcpy(slot->point, mount_point);
+    slot->length = (uint8_t)length;
+    slot->backend = backend;
+    Serial.printf("[STORAGE] %s volume mounted at %s\n", backend->getName(), mount_point);
     return true;
 }
 
+void StorageService::unmount(const char *mount_point) {
+    StorageLock guard;
+    Mount *mount = findMount(mount_point);
+    if (mount == nullptr) return;
+
+    // Streams on the volume too: their owners get -1 from now on
+    for (uint8_t i = 0; i < STORAGE_OPEN_FILES; i++) {
+        FileHandle &handle = handles[i];
+        if (handle.open && strncmp(handle.path, mount->point, mount->length) == 0 &&
+            (mount->length == 1 || handle.path[mount->length] == '/')) {
+            closeHandle(handle);
+        }
+    }
+
+    mount->backend->end();
+    mount->backend = nullptr;
+    mount->point[0] = '\0';
+}
+
+bool StorageService::isMounted(const char *mount_point) {
+    StorageLock guard;
+    return findMount(mount_point) != nullptr;
+}
+
+bool StorageService::getVolumeInfo(const char *mount_point, uint64_t &total_bytes, uint64_t &used_bytes) {
+    StorageLock guard;
+    total_bytes = 0;
+    used_bytes = 0;
+    Mount *mount = findMount(mount_point);
+    return mount != nullptr && mount->backend->getSpace(total_bytes, used_bytes);
+}
+
+StorageService::Mount* StorageService::findMount(const char *mount_point) {
+    if (mount_point == nullptr) return nullptr;
+    for (uint8_t i = 0; i < STORAGE_MAX_MOUNTS; i++) {
+        if (mounts[i].backend != nullptr && strcmp(mounts[i].point, mount_point) == 0) {
+            return &mounts[i];
+        }
+    }
+    return nullptr;
+}
+
+// Longest mount point that prefixes the path, and the path within it
+fs::FS* StorageService::resolve(const char *path, const char *&volume_path) {
+    if (path == nullptr) return nullptr;
+
+    Mount *best = nullptr;
+    for (uint8_t i = 0; i < STORAGE_MAX_MOUNTS; i++) {
+        Mount &mount = mounts[i];
+        if (mount.backend == nullptr || (best != nullptr && mount.length <= best->length)) continue;
+        if (mount.length == 1 ||
+            (strncmp(path, mount.point, mount.length) == 0 &&
+             (path[mount.length] == '/' || path[mount.length] == '\0'))) {
+            best = &mount;
+        }
+    }
+    if (best == nullptr) return nullptr;
+
+    volume_path = best->length == 1 ? path : path + best->length;
+    if (volume_path[0] == '\0') volume_path = "/";
+    return &best->backend->getFS();
+}
+
+bool StorageService::fileExists(const char *filepath) {
+    StorageLock guard;
+    if (!initialized) return false;
+
+    // An open handle answers without touching the card
+    for (uint8_t i = 0; i < STORAGE_OPEN_FILES; i++) {
+        if (handles[i].open && strcmp(handles[i].path, filepath) == 0) return true;
+    }
+    const char *volume_path;
+    fs::FS *volume = resolve(filepath, volume_path);
+    return volume != nullptr && volume->exists(volume_path);
+}
+
 bool StorageService::deleteFile(const char *filepath) {
-    if (!is_initialized) return false;
+    StorageLock guard;
+    if (!initialized) return false;
     
-    if (!SD.remove(filepath)) {
+    closePath(filepath);
+    const char *volume_path;
+    fs::FS *volume = resolve(filepath, volume_path);
+    if (volume == nullptr || !volume->remove(volume_path)) {
         Serial.printf("[STORAGE] Failed to delete file: %s\n", filepath);
         return false;
     }
@@ -63,139 +216,626 @@ bool StorageService::deleteFile(const char *filepath) {
     return true;
 }
 
-bool StorageService::readFile(const char *filepath, char *buffer, uint32_t max_len) {
-    if (!is_initialized) return false;
-    
-    File file = SD.open(filepath, FILE_READ);
+bool StorageService::renameFile(const char *from, const char *to) {
+    StorageLock guard;
+    if (!initialized) return false;
+
+    const char *volume_from;
+    const char *volume_to;
+    fs::FS *volume = resolve(from, volume_from);
+    if (volume == nullptr || volume != resolve(to, volume_to)) {
+        Serial.printf("[STORAGE] Cannot rename across volumes: %s\n", from);
+        return false;
+    }
+
+    closePath(from);
+    closePath(to);
+    if (!volume->rename(volume_from, volume_to)) {
+        Serial.printf("[STORAGE] Failed to rename file: %s\n", from);
+        return false;
+    }
+    return true;
+}
+
+bool StorageService::readFile(const char *filepath, uint8_t *buffer, uint32_t size) {
+    // No log line here: at 115200 baud it would cost more than the read
+    return readAt(filepath, 0, buffer, size) >= 0;
+}
+
+int32_t StorageService::readAt(const char *filepath, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    StorageLock guard;
+    if (!initialized) return -1;
+
+    FileHandle *handle = acquire(filepath);
+    if (handle == nullptr) return -1;
+    return readHandle(*handle, offset, buffer, size);
+}
+
+bool StorageService::postFileRead(const char *filepath) {
+    StorageLock guard;
+    if (!initialized) return false;
+
+    FileHandle *handle = acquire(filepath);
+    if (handle == nullptr) return false;
+
+    // First block of the file is read straight into a pool block
+    EventPayload *payload = EventPayloads::alloc();
+    if (payload == nullptr) {
+        Serial.println("[STORAGE] No payload block for read");
+        return false;
+    }
+
+    int32_t bytes_read = readHandle(*handle, 0, payload->data, EVENT_PAYLOAD_SIZE);
+    payload->length = bytes_read > 0 ? (uint16_t)bytes_read : 0;
+    bool truncated = handle->size > payload->length;
+
+    Event event = {
+        .type = EVENT_STORAGE_READ,
+        .priority = PRIORITY_NORMAL,
+        .timestamp = millis(),
+        .data1 = (uint8_t)(truncated ? 1 : 0),
+        .data2 = 0,
+        .data3 = payload
+    };
+    return Kernel::postEvent(event);
+}
+
+void StorageService::getSnapshotPath(const char *app_name, char *path, uint32_t max_len) {
+    snprintf(path, max_len, "%s/%s.snap", APP_SNAPSHOT_DIR, app_name);
+}
+
+bool StorageService::writeAppSnapshot(const char *app_name, const uint8_t *data, uint16_t length) {
+    StorageLock guard;
+    if (!initialized) return false;
+
+    if (!ensureDir(APP_SNAPSHOT_DIR)) {
+        Serial.println("[STORAGE] Failed to create snapshot directory");
+        return false;
+    }
+
+    char path[64];
+    getSnapshotPath(app_name, path, sizeof(path));
+    closePath(path);
+
+    const char *volume_path;
+    fs::FS *volume = resolve(path, volume_path);
+    File file = volume ? volume->open(volume_path, FILE_WRITE) : File();
     if (!file) {
-        Serial.printf("[STORAGE] Failed to open file: %s\n", filepath);
+        Serial.printf("[STORAGE] Failed to open snapshot: %s\n", path);
         return false;
     }
-    
-    uint32_t bytes_read = 0;
-    while (file.available() && bytes_read < max_len - 1) {
-        buffer[bytes_read++] = file.read();
+
+    uint32_t bytes_written = file.write(data, length);
+    file.close();
+    return bytes_written == length;
+}
+
+int32_t StorageService::readAppSnapshot(const char *app_name, uint8_t *data, uint16_t capacity) {
+    StorageLock guard;
+    if (!initialized) return -1;
+
+    char path[64];
+    getSnapshotPath(app_name, path, sizeof(path));
+
+    const char *volume_path;
+    fs::FS *volume = resolve(path, volume_path);
+    if (volume == nullptr) return -1;
+
+    File file = volume->open(volume_path, FILE_READ);
+    if (!file) {
+        return -1;
     }
-    buffer[bytes_read] = '\0';
-    
+
+    // Larger than the caller's buffer: not a snapshot we wrote
+    if (file.size() > capacity) {
+        file.close();
+        return -1;
+    }
+
+    int32_t bytes_read = file.read(data, file.size());
     file.close();
-    Serial.printf("[STORAGE] Read %d bytes from: %s\n", bytes_read, filepath);
-    return true;
+
+    // One-shot: the app owns its state again
+    closePath(path);
+    volume->remove(volume_path);
+    return bytes_read;
 }
 
-bool StorageService::writeFile(const char *filepath, const char *data) {
-    if (!is_initialized) return false;
+bool StorageService::writeFile(const char *filepath, const uint8_t *data, uint32_t size) {
+    StorageLock guard;
+    if (!initialized) return false;
     
-    File file = SD.open(filepath, FILE_WRITE);
+    closePath(filepath);
+    const char *volume_path;
+    fs::FS *volume = resolve(filepath, volume_path);
+    File file = volume ? volume->open(volume_path, FILE_WRITE) : File();
     if (!file) {
         Serial.printf("[STORAGE] Failed to open file for writing: %s\n", filepath);
         return false;
     }
     
-    uint32_t bytes_written = file.print(data);
+    uint32_t bytes_written = file.write(data, size);
     file.close();
     
-    Serial.printf("[STORAGE] Wrote %d bytes to: %s\n", bytes_written, filepath);
-    return bytes_written > 0;
+    Serial.printf("[STORAGE] Wrote %lu bytes to: %s\n", (unsigned long)bytes_written, filepath);
+    return bytes_written == size;
 }
 
-bool StorageService::appendFile(const char *filepath, const char *data) {
-    if (!is_initialized) return false;
+bool StorageService::appendFile(const char *filepath, const uint8_t *data, uint32_t size) {
+    StorageLock guard;
+    if (!initialized) return false;
     
-    File file = SD.open(filepath, FILE_APPEND);
+    closePath(filepath);
+    const char *volume_path;
+    fs::FS *volume = resolve(filepath, volume_path);
+    File file = volume ? volume->open(volume_path, FILE_APPEND) : File();
     if (!file) {
         Serial.printf("[STORAGE] Failed to open file for appending: %s\n", filepath);
         return false;
     }
     
-    uint32_t bytes_written = file.print(data);
+    uint32_t bytes_written = file.write(data, size);
     file.close();
     
-    Serial.printf("[STORAGE] Appended %d bytes to: %s\n", bytes_written, filepath);
-    return bytes_written > 0;
+    Serial.printf("[STORAGE] Appended %lu bytes to: %s\n", (unsigned long)bytes_written, filepath);
+    return bytes_written == size;
+}
+
+bool StorageService::saveSetting(const char *key, const char *value) {
+    return SettingsStore::setString(key, value);
+}
+
+bool StorageService::loadSetting(const char *key, char *value, uint32_t max_len) {
+    return SettingsStore::getString(key, value, max_len);
 }
 
 uint32_t StorageService::getFileSize(const char *filepath) {
-    if (!is_initialized) return 0;
+    StorageLock guard;
+    if (!initialized) return 0;
     
-    File file = SD.open(filepath, FILE_READ);
-    if (!file) {
-        return 0;
+    // Opening it now also serves the read that usually follows
+    FileHandle *handle = acquire(filepath);
+    return handle ? handle->size : 0;
+}
+
+bool StorageService::createDir(const char *path) {
+    StorageLock guard;
+    if (!initialized) return false;
+
+    const char *volume_path;
+    fs::FS *volume = resolve(path, volume_path);
+    if (volume == nullptr || !volume->mkdir(volume_path)) {
+        Serial.printf("[STORAGE] Failed to create directory: %s\n", path);
+        return false;
     }
-    
-    uint32_t size = file.size();
-    file.close();
-    
-    return size;
+    return true;
 }
 
-bool StorageService::listFiles(const char *directory, char *buffer, uint32_t max_len) {
-    if (!is_initialized) return false;
-    
-    File dir = SD.open(directory);
+bool StorageService::ensureDir(const char *path) {
+    const char *volume_path;
+    fs::FS *volume = resolve(path, volume_path);
+    return volume != nullptr && (volume->exists(volume_path) || volume->mkdir(volume_path));
+}
+
+bool StorageService::listDir(const char *directory, void (*callback)(const char *filename)) {
+    StorageLock guard;
+    if (!initialized || callback == nullptr) return false;
+
+    const char *volume_path;
+    fs::FS *volume = resolve(directory, volume_path);
+    File dir = volume ? volume->open(volume_path) : File();
     if (!dir || !dir.isDirectory()) {
         Serial.printf("[STORAGE] Failed to open directory: %s\n", directory);
         return false;
     }
     
-    buffer[0] = '\0';
-    uint32_t remaining = max_len;
-    
+    uint16_t count = 0;
     File file = dir.openNextFile();
-    while (file && remaining > 0) {
-        const char *name = file.name();
-        uint32_t name_len = strlen(name);
-        
-        if (name_len + 2 <= remaining) {
-            strcat(buffer, name);
-            strcat(buffer, "\n");
-            remaining -= (name_len + 1);
-        }
-        
+    while (file && count < SD_MAX_FILES) {
+        callback(file.name());
+        count++;
         file = dir.openNextFile();
     }
     
     dir.close();
-    Serial.printf("[STORAGE] Listed files in: %s\n", directory);
     return true;
 }
 
-uint32_t StorageService::getTotalSpace() {
-    if (!is_initialized) return 0;
-    
-    // SD card total space depends on card size
-    // For now, return a placeholder
-    return 0;
+bool StorageService::getCardInfo(uint32_t &total_bytes, uint32_t &used_bytes) {
+    // Reported in bytes; cards over 4 GB saturate
+    uint64_t total, used;
+    bool mounted = getVolumeInfo(SD_MOUNT_POINT, total, used);
+    total_bytes = total > UINT32_MAX ? UINT32_MAX : (uint32_t)total;
+    used_bytes = used > UINT32_MAX ? UINT32_MAX : (uint32_t)used;
+    return mounted;
 }
 
-uint32_t StorageService::getFreeSpace() {
-    if (!is_initialized) return 0;
-    
-    // Free space calculation not available in Arduino SD library
-    // For now, return a placeholder
-    return 0;
+bool StorageService::isCardPresent() {
+    StorageLock guard;
+    Mount *mount = findMount(SD_MOUNT_POINT);
+    return mount != nullptr && mount->backend->isPresent();
+}
+
+// Read handle table
+StorageService::FileHandle* StorageService::acquire(const char *filepath) {
+    if (filepath == nullptr || strlen(filepath) >= STORAGE_PATH_MAX) {
+        Serial.println("[STORAGE] Path too long for a read handle");
+        return nullptr;
+    }
+
+    for (uint8_t i = 0; i < STORAGE_OPEN_FILES; i++) {
+        FileHandle &handle = handles[i];
+        if (handle.open && !handle.stream && strcmp(handle.path, filepath) == 0) {
+            handle.last_use = ++handle_clock;
+            stats.handle_hits++;
+            return &handle;
+        }
+    }
+
+    FileHandle *handle = claimHandle();
+    if (handle == nullptr) {
+        Serial.println("[STORAGE] All file handles are held by streams");
+        return nullptr;
+    }
+    return openHandle(*handle, filepath, FILE_READ) ? handle : nullptr;
+}
+
+StorageService::FileHandle* StorageService::claimHandle() {
+    // Free slot first, else the least recently used shared handle
+    FileHandle *victim = nullptr;
+    for (uint8_t i = 0; i < STORAGE_OPEN_FILES; i++) {
+        FileHandle &handle = handles[i];
+        if (!handle.open) return &handle;
+        if (!handle.stream && (victim == nullptr || handle.last_use < victim->last_use)) {
+            victim = &handle;
+        }
+    }
+
+    if (victim != nullptr) closeHandle(*victim);
+    return victim;
+}
+
+bool StorageService::openHandle(FileHandle &handle, const char *filepath, const char *mode) {
+    const char *volume_path;
+    fs::FS *volume = resolve(filepath, volume_path);
+    if (volume == nullptr) {
+        Serial.printf("[STORAGE] No volume mounted for: %s\n", filepath);
+        return false;
+    }
+
+    handle.file = volume->open(volume_path, mode);
+    if (!handle.file || handle.file.isDirectory()) {
+        handle.file.close();
+        Serial.printf("[STORAGE] Failed to open file: %s\n", filepath);
+        return false;
+    }
+
+    strcpy(handle.path, filepath);
+    handle.open = true;
+    handle.stream = false;
+    handle.writable = false;
+    handle.size = handle.file.size();
+    handle.file_pos = 0;
+    handle.cursor = 0;
+    handle.cache_start = 0;
+    handle.cache_len = 0;
+    handle.last_use = ++handle_clock;
+    stats.opens++;
+    return true;
+}
+
+void StorageService::closeHandle(FileHandle &handle) {
+    if (!handle.open) return;
+    handle.file.close();
+    handle.open = false;
+    handle.stream = false;
+}
+
+// Drop the shared handles on a path (streams stay with their owners)
+void StorageService::closePath(const char *filepath) {
+    for (uint8_t i = 0; i < STORAGE_OPEN_FILES; i++) {
+        if (handles[i].open && !handles[i].stream && strcmp(handles[i].path, filepath) == 0) {
+            closeHandle(handles[i]);
+        }
+    }
+}
+
+void StorageService::closeFile(const char *filepath) {
+    StorageLock guard;
+    closePath(filepath);
+}
+
+void StorageService::closeAll() {
+    StorageLock guard;
+    for (uint8_t i = 0; i < STORAGE_OPEN_FILES; i++) {
+        closeHandle(handles[i]);
+    }
+}
+
+// Streams
+StorageHandle StorageService::openStream(const char *filepath, StorageMode mode) {
+    StorageLock guard;
+    if (!initialized) return STORAGE_NO_HANDLE;
+    if (filepath == nullptr || strlen(filepath) >= STORAGE_PATH_MAX) {
+        Serial.println("[STORAGE] Path too long for a stream");
+        return STORAGE_NO_HANDLE;
+    }
+
+    // A writer invalidates what the shared handles have read ahead
+    if (mode != STORAGE_MODE_READ) closePath(filepath);
+
+    FileHandle *handle = claimHandle();
+    if (handle == nullptr) {
+        Serial.println("[STORAGE] No free file handle for a stream");
+        return STORAGE_NO_HANDLE;
+    }
+
+    const char *file_mode = mode == STORAGE_MODE_READ ? FILE_READ
+                          : mode == STORAGE_MODE_WRITE ? FILE_WRITE : FILE_APPEND;
+    if (!openHandle(*handle, filepath, file_mode)) {
+        return STORAGE_NO_HANDLE;
+    }
+
+    handle->stream = true;
+    handle->writable = mode != STORAGE_MODE_READ;
+    if (mode == STORAGE_MODE_APPEND) {
+        handle->cursor = handle->size;
+        handle->file_pos = handle->size;
+    }
+    return (StorageHandle)(handle - handles);
+}
+
+StorageService::FileHandle* StorageService::streamHandle(StorageHandle handle) {
+    if (handle < 0 || handle >= STORAGE_OPEN_FILES) return nullptr;
+    FileHandle &file = handles[handle];
+    return file.open && file.stream ? &file : nullptr;
+}
+
+void StorageService::closeStream(StorageHandle handle) {
+    StorageLock guard;
+    FileHandle *file = streamHandle(handle);
+    if (file != nullptr) closeHandle(*file);
+}
+
+int32_t StorageService::read(StorageHandle handle, uint8_t *buffer, uint32_t size) {
+    StorageLock guard;
+    FileHandle *file = streamHandle(handle);
+    if (file == nullptr || file->writable) return -1;
+
+    int32_t bytes_read = readHandle(*file, file->cursor, buffer, size);
+    file->cursor += bytes_read;
+    return bytes_read;
+}
+
+bool StorageService::readLine(StorageHandle handle, char *line, uint32_t max_len) {
+    StorageLock guard;
+    if (max_len == 0) return false;
+    line[0] = '\0';
+    FileHandle *file = streamHandle(handle);
+    if (file == nullptr || file->writable) return false;
+
+    // Lines are short: these reads come out of the read-ahead block
+    int32_t got = readHandle(*file, file->cursor, (uint8_t*)line, max_len - 1);
+    if (got <= 0) return false;
+
+    // A line longer than max_len - 1 continues on the next call
+    char *newline = (char*)memchr(line, '\n', got);
+    uint32_t length = newline ? (uint32_t)(newline - line) : (uint32_t)got;
+    file->cursor += newline ? length + 1 : length;
+    if (length > 0 && line[length - 1] == '\r') length--;
+    line[length] = '\0';
+    return true;
 }
 
-bool StorageService::isInitialized() {
-    return is_initialized;
+int32_t StorageService::write(StorageHandle handle, const uint8_t *data, uint32_t size) {
+    StorageLock guard;
+    FileHandle *file = streamHandle(handle);
+    if (file == nullptr || !file->writable) return -1;
+
+    if (file->file_pos != file->cursor && !file->file.seek(file->cursor)) {
+        return -1;
+    }
+    uint32_t bytes_written = file->file.write(data, size);
+    file->cursor += bytes_written;
+    file->file_pos = file->cursor;
+    if (file->cursor > file->size) file->size = file->cursor;
+    return (int32_t)bytes_written;
+}
+
+int32_t StorageService::readInto(StorageHandle handle, ByteRing &ring, uint32_t max_bytes) {
+    StorageLock guard;
+    FileHandle *file = streamHandle(handle);
+    if (file == nullptr || file->writable) return -1;
+
+    // Straight into the ring: up to the wrap, then from its start
+    uint32_t moved = 0;
+    while (moved < max_bytes) {
+        uint8_t *region;
+        uint32_t space = ring.writable(region);
+        if (space == 0) break;
+        if (space > max_bytes - moved) space = max_bytes - moved;
+
+        int32_t bytes_read = readHandle(*file, file->cursor, region, space);
+        if (bytes_read <= 0) break;
+        ring.commit(bytes_read);
+        file->cursor += bytes_read;
+        moved += bytes_read;
+        if ((uint32_t)bytes_read < space) break;
+    }
+    return (int32_t)moved;
+}
+
+bool StorageService::seek(StorageHandle handle, uint32_t offset) {
+    StorageLock guard;
+    FileHandle *file = streamHandle(handle);
+    if (file == nullptr || offset > file->size) return false;
+    file->cursor = offset;
+    return true;
+}
+
+uint32_t StorageService::tell(StorageHandle handle) {
+    StorageLock guard;
+    FileHandle *file = streamHandle(handle);
+    return file ? file->cursor : 0;
+}
+
+uint32_t StorageService::getStreamSize(StorageHandle handle) {
+    StorageLock guard;
+    FileHandle *file = streamHandle(handle);
+    return file ? file->size : 0;
+}
+
+bool StorageService::isEof(StorageHandle handle) {
+    StorageLock guard;
+    FileHandle *file = streamHandle(handle);
+    return file == nullptr || file->cursor >= file->size;
+}
+
+int32_t StorageService::readChunks(const char *filepath, uint8_t *chunk, uint32_t chunk_size,
+                                   StorageChunkFn callback, void *context) {
+    if (callback == nullptr) return -1;
+
+    FileReader reader;
+    if (!reader.open(filepath, chunk, chunk_size)) return -1;
+
+    uint32_t delivered = 0;
+    while (reader.next()) {
+        delivered += reader.length();
+        if (!callback(reader.data(), reader.length(), reader.offset(), context)) break;
+    }
+    return reader.hasError() ? -1 : (int32_t)delivered;
+}
+
+int32_t StorageService::readHandle(FileHandle &handle, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    if (offset >= handle.size || size == 0) return 0;
+    if (size > handle.size - offset) size = handle.size - offset;
+
+    uint32_t copied = 0;
+    bool cached = offset >= handle.cache_start && offset < handle.cache_start + handle.cache_len;
+
+    if (cached && offset + size <= handle.cache_start + handle.cache_len) {
+        // All of it is in the read-ahead block
+        memcpy(buffer, handle.cache + (offset - handle.cache_start), size);
+        copied = size;
+        stats.cache_hits++;
+    } else if (size >= STORAGE_READ_AHEAD) {
+        // Bulk: what the block holds, then one transfer into the caller's buffer
+        if (cached) {
+            copied = handle.cache_start + handle.cache_len - offset;
+            memcpy(buffer, handle.cache + (offset - handle.cache_start), copied);
+            stats.cache_hits++;
+        }
+        copied += deviceRead(handle, offset + copied, buffer + copied, size - copied);
+    } else {
+        // Small: refill the block so it covers the whole request (sector
+        // aligned when that fits) and copy out of it
+        uint32_t start = offset - offset % STORAGE_READ_AHEAD;
+        if (offset + size > start + STORAGE_READ_AHEAD) start = offset;
+        handle.cache_start = start;
+        handle.cache_len = deviceRead(handle, start, handle.cache, STORAGE_READ_AHEAD);
+        if (handle.cache_len > offset - start) {
+            uint32_t available = handle.cache_len - (offset - start);
+            copied = size < available ? size : available;
+            memcpy(buffer, handle.cache + (offset - start), copied);
+        }
+    }
+
+    stats.bytes_read += copied;
+    return (int32_t)copied;
+}
+
+uint32_t StorageService::deviceRead(FileHandle &handle, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    if (handle.file_pos != offset && !handle.file.seek(offset)) {
+        return 0;
+    }
+
+    uint32_t bytes_read = handle.file.read(buffer, size);
+    handle.file_pos = offset + bytes_read;
+    stats.device_reads++;
+    return bytes_read;
+}
+
+void StorageService::resetStats() {
+    memset(&stats, 0, sizeof(stats));
 }
 
 void StorageService::printDebugInfo() {
     Serial.println("\nâ•”â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•—");
     Serial.println("â•‘  STORAGE SERVICE DEBUG INFO      â•‘");
     Serial.println("â• â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•£");
-    Serial.printf("â•‘ SD Card: %s\n", is_initialized ? "READY" : "NOT READY");
-    Serial.printf("â•‘ Total Space: %lu bytes\n", getTotalSpace());
-    Serial.printf("â•‘ Free Space: %lu bytes\n", getFreeSpace());
-    Serial.println("â•‘ Root files:");
-    
-    // List root directory files
-    File root = SD.open("/");
-    File file = root.openNextFile();
-    while (file) {
-        Serial.printf("â•‘   - %s\n", file.name());
-        file = root.openNextFile();
+    Serial.printf("â•‘ Storage: %s\n", initialized ? "READY" : "NOT READY");
+    for (uint8_t i = 0; i < STORAGE_MAX_MOUNTS; i++) {
+        if (mounts[i].backend == nullptr) continue;
+        uint64_t total_bytes, used_bytes;
+        getVolumeInfo(mounts[i].point, total_bytes, used_bytes);
+        Serial.printf("â•‘ %-7s %-6s %llu / %llu bytes used\n", mounts[i].point,
+            mounts[i].backend->getName(), (unsigned long long)used_bytes,
+            (unsigned long long)total_bytes);
+
+        File root = mounts[i].backend->getFS().open("/");
+        File file = root.openNextFile();
+        while (file) {
+            Serial.printf("â•‘   - %s\n", file.name());
+            file = root.openNextFile();
+        }
     }
-    
+    Serial.printf("â•‘ Read Handles: %lu opens, %lu reuses\n",
+        (unsigned long)stats.opens, (unsigned long)stats.handle_hits);
+    Serial.printf("â•‘ Reads: %lu card reads, %lu read-ahead hits, %lu bytes\n",
+        (unsigned long)stats.device_reads, (unsigned long)stats.cache_hits,
+        (unsigned long)stats.bytes_read);
     Serial.println("â•šâ•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•â•\n");
 }
+
+// FileReader
+FileReader::FileReader()
+    : handle(STORAGE_NO_HANDLE), buffer(nullptr), capacity(0),
+      chunk_length(0), chunk_offset(0), file_size(0), failed(false) {
+}
+
+FileReader::~FileReader() {
+    close();
+}
+
+bool FileReader::open(const char *path, uint8_t *chunk_buffer, uint32_t chunk_capacity) {
+    close();
+    failed = false;
+    if (chunk_buffer == nullptr || chunk_capacity == 0) return false;
+
+    handle = StorageService::openStream(path, STORAGE_MODE_READ);
+    if (handle == STORAGE_NO_HANDLE) {
+        failed = true;
+        return false;
+    }
+
+    buffer = chunk_buffer;
+    capacity = chunk_capacity;
+    chunk_length = 0;
+    chunk_offset = 0;
+    file_size = StorageService::getStreamSize(handle);
+    return true;
+}
+
+void FileReader::close() {
+    if (handle != STORAGE_NO_HANDLE) {
+        StorageService::closeStream(handle);
+        handle = STORAGE_NO_HANDLE;
+    }
+    chunk_length = 0;
+}
+
+bool FileReader::next() {
+    if (handle == STORAGE_NO_HANDLE) return false;
+
+    chunk_offset = StorageService::tell(handle);
+    int32_t bytes_read = StorageService::read(handle, buffer, capacity);
+    if (bytes_read < 0) failed = true;
+    chunk_length = bytes_read > 0 ? (uint32_t)bytes_read : 0;
+    return chunk_length > 0;
+}
+
+bool FileReader::seek(uint32_t offset) {
+    if (handle == STORAGE_NO_HANDLE) return false;
+    chunk_length = 0;
+    return StorageService::seek(handle, offset);
+}
@@ -3,53 +3,209 @@
 
 #include <stdint.h>
 #include <Arduino.h>
-#include <SD.h>
+#include "../config/system_config.h"
+#include "../core/byte_ring.h"
+#include "storage_backend.h"
 
 // ============================================================================
 // ionOS v1.0 - STORAGE SERVICE
-// MicroSD card file I/O and data persistence
+// File I/O and data persistence over mounted volumes
+//
+// Paths start with a mount point: init() mounts the MicroSD card at
+// SD_MOUNT_POINT ("/sd/music/song1.wav") and LittleFS on the internal flash
+// at FLASH_MOUNT_POINT ("/flash/logs/system.log"). Small hot files belong
+// on flash, which answers a random read an order of magnitude faster than
+// the SD card over SPI and is there when no card is inserted; bulk media
+// belongs on the card. Other backends (a host directory on native builds)
+// can be mounted next to them.
+//
+// Reads go through a small table of open read handles: a file stays open
+// between calls (no re-open, size known), bulk reads are single multi-KB
+// File::read() transfers, and small reads (lines, records) are served from
+// a per-handle read-ahead block. Writes and deletes close the path's handle
+// first.
+//
+// Files larger than RAM are streamed: openStream() pins one of the handles
+// for the caller, who reads or writes it a chunk at a time (into a ByteRing
+// for producer/consumer pipelines, or with the pull-based FileReader).
+// Calls are serialized by a lock, so the kernel loop and runner tasks can
+// share the service.
 // ============================================================================
 
+// Stream handle (index into the handle table)
+typedef int8_t StorageHandle;
+static const StorageHandle STORAGE_NO_HANDLE = -1;
+
+enum StorageMode {
+    STORAGE_MODE_READ = 0,
+    STORAGE_MODE_WRITE = 1,     // Create or truncate
+    STORAGE_MODE_APPEND = 2
+};
+
+// Chunk callback for readChunks(); return false to stop early
+typedef bool (*StorageChunkFn)(const uint8_t *data, uint32_t length, uint32_t offset, void *context);
+
+// Read path counters
+struct StorageStats {
+    uint32_t opens;             // Files opened for reading
+    uint32_t handle_hits;       // Reads that reused an open handle
+    uint32_t cache_hits;        // Reads served (at least partly) from read-ahead
+    uint32_t device_reads;      // File::read() calls issued to the card
+    uint32_t bytes_read;        // Bytes returned to callers
+};
+
 class StorageService {
 public:
     // Initialization
     static bool init();
     static void shutdown();
 
+    // Volumes
+    static bool mount(const char *mount_point, StorageBackend *backend);   // Calls backend->begin()
+    static void unmount(const char *mount_point);    // Closes its handles and streams
+    static bool isMounted(const char *mount_point);
+    static bool getVolumeInfo(const char *mount_point, uint64_t &total_bytes, uint64_t &used_bytes);
+
     // File operations
     static bool fileExists(const char *path);
     static bool deleteFile(const char *path);
+    static bool renameFile(const char *from, const char *to);      // Same volume only
     static uint32_t getFileSize(const char *path);
 
     // Read operations
-    static bool readFile(const char *path, uint8_t *buffer, uint32_t size);
-    static bool readLine(const char *path, char *line, uint32_t max_len);
+    static bool readFile(const char *path, uint8_t *buffer, uint32_t size);    // Up to size bytes from the start
+    static int32_t readAt(const char *path, uint32_t offset, uint8_t *buffer, uint32_t size);  // Bytes read, -1 on error
+    static bool postFileRead(const char *path);  // Data arrives as EVENT_STORAGE_READ
+    static void closeFile(const char *path);     // Drop the path's read handle
+    static void closeAll();
 
     // Write operations
     static bool writeFile(const char *path, const uint8_t *data, uint32_t size);
     static bool appendFile(const char *path, const uint8_t *data, uint32_t size);
 
+    // Streams (each holds a handle until closed; reads past the end return 0)
+    static StorageHandle openStream(const char *path, StorageMode mode);
+    static void closeStream(StorageHandle handle);
+    static int32_t read(StorageHandle handle, uint8_t *buffer, uint32_t size);        // Bytes read, -1 on error
+    static bool readLine(StorageHandle handle, char *line, uint32_t max_len);         // Next line; false at the end
+    static int32_t write(StorageHandle handle, const uint8_t *data, uint32_t size);   // Bytes written, -1 on error
+    static int32_t readInto(StorageHandle handle, ByteRing &ring, uint32_t max_bytes = UINT32_MAX);  // Fills free ring space
+    static bool seek(StorageHandle handle, uint32_t offset);
+    static uint32_t tell(StorageHandle handle);
+    static uint32_t getStreamSize(StorageHandle handle);
+    static bool isEof(StorageHandle handle);
+
+    // Whole file through a callback, chunk_size bytes at a time; returns
+    // the bytes delivered, or -1 if the file could not be read
+    static int32_t readChunks(const char *path, uint8_t *chunk, uint32_t chunk_size,
+                              StorageChunkFn callback, void *context);
+
     // Directory operations
     static bool createDir(const char *path);
     static bool listDir(const char *path, void (*callback)(const char *filename));
 
-    // Settings persistence
+    // App state snapshots (registered with the kernel by init)
+    static bool writeAppSnapshot(const char *app_name, const uint8_t *data, uint16_t length);
+    static int32_t readAppSnapshot(const char *app_name, uint8_t *data, uint16_t capacity);
+
+    // Settings persistence (string values in the SettingsStore)
     static bool saveSetting(const char *key, const char *value);
     static bool loadSetting(const char *key, char *value, uint32_t max_len);
 
-    // SD card info
+    // SD card info (the volume at SD_MOUNT_POINT)
     static bool getCardInfo(uint32_t &total_bytes, uint32_t &used_bytes);
     static bool isCardPresent();
 
     // Debug
+    static const StorageStats& getStats() { return stats; }
+    static void resetStats();
     static void printDebugInfo();
 
 private:
+    // An open file with its read-ahead block. Shared handles are found by
+    // path and recycled least recently used first; stream handles belong
+    // to whoever opened them.
+    struct FileHandle {
+        File file;
+        char path[STORAGE_PATH_MAX];
+        bool open;
+        bool stream;
+        bool writable;
+        uint32_t size;
+        uint32_t file_pos;          // Where the next File::read() starts
+        uint32_t cursor;            // Stream position
+        uint32_t cache_start;       // File offset of cache[0]
+        uint16_t cache_len;
+        uint32_t last_use;
+        uint8_t cache[STORAGE_READ_AHEAD];
+    };
+
+    struct Mount {
+        char point[16];
+        uint8_t length;
+        StorageBackend *backend;    // nullptr = free slot
+    };
+
     static bool initialized;
-    static const char *SETTINGS_FILE;
+
+    static Mount mounts[STORAGE_MAX_MOUNTS];
+    static FileHandle handles[STORAGE_OPEN_FILES];
+    static uint32_t handle_clock;
+    static StorageStats stats;
 
     // Internal helpers
+    static Mount* findMount(const char *mount_point);
+    static fs::FS* resolve(const char *path, const char *&volume_path);
     static bool ensureDir(const char *path);
+    static void getSnapshotPath(const char *app_name, char *path, uint32_t max_len);
+    static FileHandle* acquire(const char *path);
+    static FileHandle* claimHandle();
+    static bool openHandle(FileHandle &handle, const char *path, const char *mode);
+    static FileHandle* streamHandle(StorageHandle handle);
+    static void closeHandle(FileHandle &handle);
+    static void closePath(const char *path);
+    static int32_t readHandle(FileHandle &handle, uint32_t offset, uint8_t *buffer, uint32_t size);
+    static uint32_t deviceRead(FileHandle &handle, uint32_t offset, uint8_t *buffer, uint32_t size);
+};
+
+// Pull-based chunk iterator over a file, in a buffer the caller provides:
+//
+//     FileReader reader;
+//     if (reader.open("/sd/music/track.wav", chunk, sizeof(chunk))) {
+//         while (reader.next()) consume(reader.data(), reader.length());
+//     }
+//
+// Holds a stream handle until close() or destruction.
+class FileReader {
+public:
+    FileReader();
+    ~FileReader();
+
+    bool open(const char *path, uint8_t *buffer, uint32_t capacity);
+    void close();
+
+    // Load the next chunk; false at the end of the file or on error
+    bool next();
+    bool seek(uint32_t offset);     // Next chunk starts here
+
+    const uint8_t* data() const { return buffer; }
+    uint32_t length() const { return chunk_length; }
+    uint32_t offset() const { return chunk_offset; }    // File offset of data()[0]
+    uint32_t size() const { return file_size; }
+    bool isOpen() const { return handle != STORAGE_NO_HANDLE; }
+    bool hasError() const { return failed; }
+
+private:
+    StorageHandle handle;
+    uint8_t *buffer;
+    uint32_t capacity;
+    uint32_t chunk_length;
+    uint32_t chunk_offset;
+    uint32_t file_size;
+    bool failed;
+
+    FileReader(const FileReader&) = delete;
+    FileReader& operator=(const FileReader&) = delete;
 };
 
 #endif // IONOS_STORAGE_SERVICE_H
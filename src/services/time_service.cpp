@@ -1,5 +1,13 @@
 #include "time_service.h"
 #include "../drivers/rtc_driver.h"
+#include "../core/kernel.h"
+
+#ifdef IONOS_NATIVE
+#include <pthread.h>
+#else
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
 
 // ============================================================================
 // ionOS v1.0 - TIME SERVICE IMPLEMENTATION
@@ -10,11 +18,45 @@ Alarm TimeService::alarms[TimeService::MAX_ALARMS];
 uint8_t TimeService::alarm_count = 0;
 uint32_t TimeService::startup_time = 0;
 uint32_t TimeService::last_sync_time = 0;
+int8_t TimeService::task_id = -1;
+
+// Alarm table lock: add/remove/enable from apps on the kernel loop, checks
+// on the service runner
+#ifdef IONOS_NATIVE
+static pthread_mutex_t alarm_mutex = PTHREAD_MUTEX_INITIALIZER;
+#else
+static StaticSemaphore_t alarm_mutex_buffer;
+static SemaphoreHandle_t alarm_mutex = nullptr;
+#endif
+
+class AlarmLock {
+public:
+    AlarmLock() {
+#ifdef IONOS_NATIVE
+        pthread_mutex_lock(&alarm_mutex);
+#else
+        if (alarm_mutex != nullptr) xSemaphoreTake(alarm_mutex, portMAX_DELAY);
+#endif
+    }
+    ~AlarmLock() {
+#ifdef IONOS_NATIVE
+        pthread_mutex_unlock(&alarm_mutex);
+#else
+        if (alarm_mutex != nullptr) xSemaphoreGive(alarm_mutex);
+#endif
+    }
+};
 
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 // Initialize time service
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool TimeService::init() {
+#ifndef IONOS_NATIVE
+    if (alarm_mutex == nullptr) {
+        alarm_mutex = xSemaphoreCreateMutexStatic(&alarm_mutex_buffer);
+    }
+#endif
+
     startup_time = millis();
     alarm_count = 0;
 
@@ -25,6 +67,14 @@ bool TimeService::init() {
         alarms[i].callback = nullptr;
     }
 
+    // Alarms are checked on the service runner; callbacks come back to the
+    // kernel loop as EVENT_SYSTEM_ALARM
+    task_id = Kernel::registerTask("time", update, TIME_CHECK_INTERVAL_MS * 1000UL, false, RUNNER_SERVICE);
+    Kernel::subscribe(EVENT_SYSTEM_ALARM, onAlarm);
+
+    // Catch alarms that came due while asleep
+    Kernel::subscribe(EVENT_POWER_WAKE, onWake);
+
     Serial.println("[TIME_SERVICE] Time service initialized");
     return true;
 }
@@ -75,6 +125,7 @@ void TimeService::setDate(uint8_t day, uint8_t month, uint16_t year) {
 // Add alarm
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool TimeService::addAlarm(uint8_t hour, uint8_t minute, void (*callback)()) {
+    AlarmLock guard;
     if (alarm_count >= MAX_ALARMS) {
         Serial.println("[TIME_SERVICE] Alarm list full");
         return false;
@@ -95,6 +146,7 @@ bool TimeService::addAlarm(uint8_t hour, uint8_t minute, void (*callback)()) {
 // Remove alarm
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool TimeService::removeAlarm(uint8_t index) {
+    AlarmLock guard;
     if (index >= alarm_count) return false;
 
     // Shift array down
@@ -111,6 +163,7 @@ bool TimeService::removeAlarm(uint8_t index) {
 // Enable alarm
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool TimeService::enableAlarm(uint8_t index) {
+    AlarmLock guard;
     if (index >= alarm_count) return false;
     alarms[index].enabled = true;
     return true;
@@ -120,6 +173,7 @@ bool TimeService::enableAlarm(uint8_t index) {
 // Disable alarm
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 bool TimeService::disableAlarm(uint8_t index) {
+    AlarmLock guard;
     if (index >= alarm_count) return false;
     alarms[index].enabled = false;
     return true;
@@ -175,6 +229,7 @@ void TimeService::update() {
 // â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
 void TimeService::checkAlarms() {
     DateTime now = getTime();
+    AlarmLock guard;
 
     for (int i = 0; i < alarm_count; i++) {
         if (!alarms[i].enabled) continue;
@@ -200,9 +255,46 @@ void TimeService::fireAlarm(uint8_t index) {
 
     Serial.printf("[TIME_SERVICE] Alarm %d triggered!\n", index);
 
-    // Call user callback if set
-    if (alarms[index].callback != nullptr) {
-        alarms[index].callback();
+    // Runs on the service runner: hand the callback to the kernel loop
+    Event event = {
+        .type = EVENT_SYSTEM_ALARM,
+        .priority = PRIORITY_HIGH,
+        .timestamp = millis(),
+        .data1 = index,
+        .data2 = 0,
+        .data3 = nullptr
+    };
+    Kernel::postEvent(event);
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Alarm fired (subscriber, kernel loop)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void TimeService::onAlarm(const Event &event) {
+    uint8_t index = event.data1;
+    void (*callback)() = nullptr;
+    {
+        AlarmLock guard;
+        if (index < alarm_count) callback = alarms[index].callback;
+    }
+
+    // Outside the lock: the callback may add or remove alarms
+    if (callback != nullptr) {
+        callback();
+    }
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Woken from sleep (subscriber)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+void TimeService::onWake(const Event &event) {
+    (void)event;
+
+    // Check right away, on the runner that owns the alarm table
+    if (task_id >= 0) {
+        Kernel::signalTask(task_id);
+    } else {
+        checkAlarms();
     }
 }
 
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <Arduino.h>
 #include "../drivers/rtc_driver.h"
+#include "../core/events.h"
 
 // ============================================================================
 // ionOS v1.0 - TIME SERVICE
@@ -56,10 +57,13 @@ private:
 
     static uint32_t startup_time;
     static uint32_t last_sync_time;
+    static int8_t task_id;              // Alarm check on the service runner
 
     // Internal helpers
     static void checkAlarms();
     static void fireAlarm(uint8_t index);
+    static void onWake(const Event &event);
+    static void onAlarm(const Event &event);
 };
 
 #endif // IONOS_TIME_SERVICE_H
@@ -0,0 +1,69 @@
+#include "fonts.h"
+#include "../drivers/display_driver.h"
+
+// ============================================================================
+// ionOS v1.0 - FONT MANAGER IMPLEMENTATION
+// ============================================================================
+
+// Static member initialization
+const Font FontManager::font_table[] = {
+    { u8g2_font_5x8_tf,      FONT_TINY_WIDTH,   FONT_TINY_HEIGHT,   FONT_TINY,   FONT_NORMAL },
+    { u8g2_font_6x10_mf,     FONT_SMALL_WIDTH,  FONT_SMALL_HEIGHT,  FONT_SMALL,  FONT_NORMAL },
+    { u8g2_font_7x14_mf,     FONT_MEDIUM_WIDTH, FONT_MEDIUM_HEIGHT, FONT_MEDIUM, FONT_NORMAL },
+    { u8g2_font_9x18_mf,     FONT_LARGE_WIDTH,  FONT_LARGE_HEIGHT,  FONT_LARGE,  FONT_NORMAL },
+    { u8g2_font_10x20_mf,    FONT_XLARGE_WIDTH, FONT_XLARGE_HEIGHT, FONT_XLARGE, FONT_NORMAL },
+    { u8g2_font_5x8_mn,      FONT_TINY_WIDTH,   FONT_TINY_HEIGHT,   FONT_TINY,   FONT_MONOSPACE },
+    { u8g2_font_6x12_mn,     6,                 12,                 FONT_SMALL,  FONT_MONOSPACE },
+    { u8g2_font_7x14_mn,     FONT_MEDIUM_WIDTH, FONT_MEDIUM_HEIGHT, FONT_MEDIUM, FONT_MONOSPACE },
+    { u8g2_font_siji_t_6x10, FONT_SMALL_WIDTH,  FONT_SMALL_HEIGHT,  FONT_SMALL,  FONT_ICON }
+};
+const uint8_t FontManager::font_table_size = sizeof(font_table) / sizeof(font_table[0]);
+
+const uint8_t FontManager::font_widths[] = {
+    FONT_TINY_WIDTH, FONT_SMALL_WIDTH, FONT_MEDIUM_WIDTH, FONT_LARGE_WIDTH, FONT_XLARGE_WIDTH
+};
+const uint8_t FontManager::font_heights[] = {
+    FONT_TINY_HEIGHT, FONT_SMALL_HEIGHT, FONT_MEDIUM_HEIGHT, FONT_LARGE_HEIGHT, FONT_XLARGE_HEIGHT
+};
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get font by size and style (normal style if there is no match)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+const uint8_t* FontManager::getFont(FontSize size, FontStyle style) {
+    const uint8_t *fallback = nullptr;
+    for (uint8_t i = 0; i < font_table_size; i++) {
+        if (font_table[i].size != size) continue;
+        if (font_table[i].style == style) return font_table[i].data;
+        if (font_table[i].style == FONT_NORMAL) fallback = font_table[i].data;
+    }
+    return fallback ? fallback : font_table[FONT_SMALL].data;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get font dimensions
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint8_t FontManager::getFontWidth(FontSize size) {
+    return size <= FONT_XLARGE ? font_widths[size] : 0;
+}
+
+uint8_t FontManager::getFontHeight(FontSize size) {
+    return size <= FONT_XLARGE ? font_heights[size] : 0;
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Exact string width in pixels (from the glyph cache)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+uint16_t FontManager::getStringWidth(const char *str, FontSize size) {
+    return DisplayDriver::getStringWidth(str, getFont(size));
+}
+
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+// Get character at position ('\0' past the end)
+// â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€â”€
+char FontManager::getCharAt(const char *str, uint16_t index) {
+    if (str == nullptr) return '\0';
+    for (uint16_t i = 0; i < index; i++) {
+        if (str[i] == '\0') return '\0';
+    }
+    return str[index];
+}
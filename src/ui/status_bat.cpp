@@ -151,7 +151,7 @@ void StatusBar::drawBattery() {
         sprintf(bat_str, "BAT%d%%", battery_percent);
     }
 
-    uint16_t str_width = strlen(bat_str) * 6;  // Approximate character width
+    uint16_t str_width = DisplayDriver::getStringWidth(bat_str);
     DisplayDriver::drawString(DISPLAY_WIDTH - str_width - 2, 2, bat_str, false);
 }
 